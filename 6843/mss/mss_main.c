@@ -556,6 +556,165 @@ void Pcount3DDemo_CfgUpdate(void *srcPtr, uint32_t offset, uint32_t size, int8_t
     }
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Records one processing time in a timing histogram.
+ *
+ *  @param[in] hist         Timing histogram
+ *  @param[in] timeInUsec   Processing time in usec
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void Pcount3DDemo_timingHistAdd(Pcount3DDemo_TimingHist *hist, uint32_t timeInUsec)
+{
+    uint32_t bucketIdx = 0;
+    uint32_t time      = timeInUsec;
+
+    while ((time >= 2U) && (bucketIdx < (PCOUNT3DDEMO_TIMING_HIST_NUM_BUCKETS - 1U)))
+    {
+        time >>= 1;
+        bucketIdx++;
+    }
+    hist->bucket[bucketIdx]++;
+    hist->numSamples++;
+    if (timeInUsec > hist->max)
+    {
+        hist->max = timeInUsec;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the upper bound of the timing histogram bucket holding the given
+ *      percentile, limited to the maximum recorded time.
+ *
+ *  @param[in] hist         Timing histogram
+ *  @param[in] percent      Percentile [1..100]
+ *
+ *  @retval
+ *      Percentile in usec, 0 if no time was recorded
+ */
+static uint32_t Pcount3DDemo_timingHistPercentile(Pcount3DDemo_TimingHist *hist, uint32_t percent)
+{
+    uint32_t bucketIdx;
+    uint32_t count = 0;
+    uint32_t rank;
+    uint32_t upperBound;
+
+    if (hist->numSamples == 0)
+    {
+        return 0;
+    }
+
+    rank = (hist->numSamples * percent + 99U) / 100U;
+    for (bucketIdx = 0; bucketIdx < (PCOUNT3DDEMO_TIMING_HIST_NUM_BUCKETS - 1U); bucketIdx++)
+    {
+        count += hist->bucket[bucketIdx];
+        if (count >= rank)
+        {
+            break;
+        }
+    }
+
+    /* The last bucket is open ended */
+    upperBound = 2U << bucketIdx;
+    if ((bucketIdx == (PCOUNT3DDEMO_TIMING_HIST_NUM_BUCKETS - 1U)) || (upperBound > hist->max))
+    {
+        upperBound = hist->max;
+    }
+    return upperBound;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Compresses the point cloud copied from the DSP results into the UART output
+ *      format. This is done in the UART task rather than in the result handler so
+ *      that the conversions are off the path that releases the results to the DSP.
+ *      The inputs are not modified, so packing again gives the same output.
+ *
+ *  @param[in,out] objOut       UART point cloud, with header and units filled in
+ *  @param[in]     pointCloud   Point cloud copied from the DSP results
+ *  @param[in]     sideInfo     Side info (snr in dB) copied from the DSP results
+ *  @param[in]     numPoints    Number of points
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void Pcount3DDemo_packPointCloud
+(
+    MmwDemo_output_message_compressedPointCloud_uart *objOut,
+    DPIF_PointCloudSpherical                         *pointCloud,
+    DPIF_PointCloudSideInfo                          *sideInfo,
+    uint32_t                                          numPoints
+)
+{
+    uint32_t pntIdx;
+    float    azimuthScale   = 1.f / objOut->pointUint.azimuthUnit;
+    float    elevationScale = 1.f / objOut->pointUint.elevationUnit;
+    float    rangeScale     = 1.f / objOut->pointUint.rangeUnit;
+    float    dopplerScale   = 1.f / objOut->pointUint.dopplerUnit;
+    float    snrScale       = 1.f / objOut->pointUint.snrUint;
+
+    for (pntIdx = 0; pntIdx < numPoints; pntIdx++)
+    {
+        objOut->point[pntIdx].azimuth   = (int8_t)MATHUTILS_ROUND_FLOAT(pointCloud[pntIdx].azimuthAngle * azimuthScale);
+        objOut->point[pntIdx].elevation = (int8_t)MATHUTILS_ROUND_FLOAT(pointCloud[pntIdx].elevAngle * elevationScale);
+        objOut->point[pntIdx].range     = (uint16_t)MATHUTILS_ROUND_FLOAT(pointCloud[pntIdx].range * rangeScale);
+        objOut->point[pntIdx].doppler   = (int16_t)MATHUTILS_ROUND_FLOAT(pointCloud[pntIdx].velocity * dopplerScale);
+        objOut->point[pntIdx].snr       = (uint16_t)MATHUTILS_ROUND_FLOAT(sideInfo[pntIdx].snr * snrScale);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the size of the UART transmit buffer, enough for the largest packet
+ *      of the current configuration.
+ *
+ *  @retval
+ *      Size in bytes
+ */
+static uint32_t Pcount3DDemo_getUartTxBufSize(void)
+{
+    uint32_t maxNumTracks = gMmwMssMCB.trackerCfg.trackerDpuCfg.staticCfg.gtrackModuleConfig.maxNumTracks;
+    uint32_t size;
+
+    size = sizeof(MmwDemo_output_message_header);
+    size += sizeof(MmwDemo_output_message_compressedPointCloud_uart);
+    size += sizeof(MmwDemo_output_message_tl) + maxNumTracks * sizeof(trackerProc_Target);
+    size += sizeof(MmwDemo_output_message_tl) + MAX_RESOLVED_OBJECTS_PER_FRAME * sizeof(trackerProc_TargetIndex);
+#ifdef HEIGHT_DETECTION_ENABLED
+    size += sizeof(MmwDemo_output_message_tl) + maxNumTracks * sizeof(heightDet_TargetHeight);
+#endif
+    size += sizeof(MmwDemo_output_message_tl) + sizeof(uint32_t);
+    size += sizeof(MmwDemo_output_message_tl) + sizeof(Pcount3DDemo_output_message_timingHist);
+    size += MMWDEMO_OUTPUT_MSG_SEGMENT_LEN;
+
+    return size;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Copies one part of a packet into the UART transmit buffer.
+ *
+ *  @param[in] bufPtr   Write position in the transmit buffer
+ *  @param[in] src      Data to copy
+ *  @param[in] size     Size of the data in bytes
+ *
+ *  @retval
+ *      Write position after the copied data
+ */
+static uint8_t *Pcount3DDemo_uartTxBufAppend(uint8_t *bufPtr, void *src, uint32_t size)
+{
+    memcpy((void *)bufPtr, src, size);
+    return (bufPtr + size);
+}
+
 /** @brief Transmits detection data over UART
  *
  *   @param[in] uartHandle   UART driver handle
@@ -578,10 +737,11 @@ void MmwDemo_uartTxTask(UArg arg0, UArg arg1)
     uint32_t                      packetLen, subFrameIdx, frameIdx;
     uint32_t                      numPaddingBytes;
     MmwDemo_output_message_stats *timingInfo;
-    uint8_t padding[MMWDEMO_OUTPUT_MSG_SEGMENT_LEN];
+    uint8_t                      *bufPtr;
 
     MmwDemo_output_message_compressedPointCloud_uart *objOut;
     uint32_t                                          targetListLength = 0, targetIndexLength = 0, presenceIndLength = 0, targetHeightLength = 0;
+    uint32_t                                          timingHistLength, stageIdx;
     volatile uint32_t                                 startTime;
     MmwDemo_output_message_tl                         tl;
 
@@ -630,6 +790,8 @@ void MmwDemo_uartTxTask(UArg arg0, UArg arg1)
 #endif
         if (objOut->header.length > 0)
         {
+            Pcount3DDemo_packPointCloud(objOut, gMmwMssMCB.pointCloudFromDSP, gMmwMssMCB.pointCloudSideInfoFromDSP,
+                                        gMmwMssMCB.numDetectedPoints);
             packetLen += sizeof(MmwDemo_output_message_tl) + objOut->header.length;
             tlvIdx++;
         }
@@ -660,6 +822,42 @@ void MmwDemo_uartTxTask(UArg arg0, UArg arg1)
             tlvIdx++;
         }
 
+        /* Record the processing times of this frame, for the tracker and the UART this is
+         * their last completed run, so that all stages of a report cover the same frames */
+        timingHistLength = 0;
+        if (gMmwMssMCB.timingHistResetReq)
+        {
+            memset((void *)&gMmwMssMCB.timingHist, 0, sizeof(Pcount3DDemo_output_message_timingHist));
+            gMmwMssMCB.timingHistNumFrames = 0;
+            gMmwMssMCB.timingHistResetReq  = false;
+        }
+        else if (gMmwMssMCB.timingHistReportPeriod > 0)
+        {
+            Pcount3DDemo_timingHistAdd(&gMmwMssMCB.timingHist.stage[Pcount3DDemo_TimingStage_DSP_ACTIVE_FRAME],
+                                       gMmwMssMCB.frameStatsFromDSP->activeFrameProcTimeInUsec);
+            Pcount3DDemo_timingHistAdd(&gMmwMssMCB.timingHist.stage[Pcount3DDemo_TimingStage_DSP_INTER_FRAME],
+                                       gMmwMssMCB.frameStatsFromDSP->interFrameExecTimeInUsec);
+#ifdef TRACKERPROC_EN
+            Pcount3DDemo_timingHistAdd(&gMmwMssMCB.timingHist.stage[Pcount3DDemo_TimingStage_TRACKER],
+                                       gMmwMssMCB.trackerProcessingTimeInUsec);
+#endif
+            Pcount3DDemo_timingHistAdd(&gMmwMssMCB.timingHist.stage[Pcount3DDemo_TimingStage_UART_TX],
+                                       gMmwMssMCB.uartProcessingTimeInUsec);
+            gMmwMssMCB.timingHistNumFrames++;
+
+            if (gMmwMssMCB.timingHistNumFrames >= gMmwMssMCB.timingHistReportPeriod)
+            {
+                for (stageIdx = 0; stageIdx < Pcount3DDemo_TimingStage_NUM_STAGES; stageIdx++)
+                {
+                    gMmwMssMCB.timingHist.stage[stageIdx].p50 = Pcount3DDemo_timingHistPercentile(&gMmwMssMCB.timingHist.stage[stageIdx], 50);
+                    gMmwMssMCB.timingHist.stage[stageIdx].p99 = Pcount3DDemo_timingHistPercentile(&gMmwMssMCB.timingHist.stage[stageIdx], 99);
+                }
+                timingHistLength = sizeof(Pcount3DDemo_output_message_timingHist);
+                packetLen += sizeof(MmwDemo_output_message_tl) + timingHistLength;
+                tlvIdx++;
+            }
+        }
+
         header.numTLVs        = tlvIdx;
         /* Round up packet length to multiple of MMWDEMO_OUTPUT_MSG_SEGMENT_LEN */
         header.totalPacketLen = MMWDEMO_OUTPUT_MSG_SEGMENT_LEN *
@@ -669,62 +867,72 @@ void MmwDemo_uartTxTask(UArg arg0, UArg arg1)
         header.numDetectedObj = gMmwMssMCB.numDetectedPoints;
 
 
-        /* Send packet header */
-        UART_write(uartHandle,
-                   (uint8_t *)&header,
-                   sizeof(MmwDemo_output_message_header));
+        /* Assemble the packet in the transmit buffer so it goes out in a single DMA transfer */
+        bufPtr = Pcount3DDemo_uartTxBufAppend(gMmwMssMCB.uartTxBuf, (void *)&header,
+                                              sizeof(MmwDemo_output_message_header));
 
-        /* Send detected Objects */
+        /* Detected Objects */
         if (objOut->header.length > 0)
         {
-            UART_write(uartHandle,
-                       (uint8_t *)objOut,
-                       objOut->header.length + sizeof(MmwDemo_output_message_tl));
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)objOut,
+                                                  objOut->header.length + sizeof(MmwDemo_output_message_tl));
         }
-        Task_sleep(1);
-        /*Send Tracker information*/
+        /* Tracker information */
         if (numTargets > 0)
         {
             tl.type   = MMWDEMO_OUTPUT_MSG_TRACKERPROC_3D_TARGET_LIST;
             tl.length = targetListLength;
-            UART_write(uartHandle, (uint8_t *)&tl, sizeof(MmwDemo_output_message_tl));
-            UART_write(uartHandle, tList, targetListLength);
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)&tl, sizeof(MmwDemo_output_message_tl));
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)tList, targetListLength);
             GPIO_toggle(gMmwMssMCB.cfg.platformCfg.SensorStatusGPIO);
-            /* Send Target Height TLV if enabled*/
+            /* Target Height TLV if enabled*/
 #ifdef HEIGHT_DETECTION_ENABLED
             tl.type   = MMWDEMO_OUTPUT_MSG_TRACKERPROC_TARGET_HEIGHT;
             tl.length = targetHeightLength;
-
-            UART_write(uartHandle, (uint8_t *)&tl, sizeof(MmwDemo_output_message_tl));
-            UART_write(uartHandle, tHeight, targetHeightLength);
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)&tl, sizeof(MmwDemo_output_message_tl));
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)tHeight, targetHeightLength);
 #endif
         }
-        /*Send Tracker Index Information*/
+        /* Tracker Index Information */
         if ((numIndices > 0) && (numTargets > 0))
         {
             tl.type   = MMWDEMO_OUTPUT_MSG_TRACKERPROC_TARGET_INDEX;
             tl.length = targetIndexLength;
-            UART_write(uartHandle, (uint8_t *)&tl, sizeof(MmwDemo_output_message_tl));
-            UART_write(uartHandle, tIndex, targetIndexLength);
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)&tl, sizeof(MmwDemo_output_message_tl));
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)tIndex, targetIndexLength);
         }
 
-        /* Send Presence TLV if presence detect is enabled */
+        /* Presence TLV if presence detect is enabled */
         if (gMmwMssMCB.presenceDetEnabled)
         {
             tl.type   = MMWDEMO_OUTPUT_MSG_PRESCENCE_INDICATION;
             tl.length = presenceIndLength;
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)&tl, sizeof(MmwDemo_output_message_tl));
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)&(gMmwMssMCB.presenceInd), sizeof(uint32_t));
+        }
 
-            UART_write(uartHandle, (uint8_t *)&tl, sizeof(MmwDemo_output_message_tl));
-            UART_write(uartHandle, (uint8_t *)&(gMmwMssMCB.presenceInd), sizeof(uint32_t));
+        /* Timing histogram TLV, a new reporting period starts */
+        if (timingHistLength > 0)
+        {
+            tl.type   = MMWDEMO_OUTPUT_MSG_TIMING_HISTOGRAM;
+            tl.length = timingHistLength;
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)&tl, sizeof(MmwDemo_output_message_tl));
+            bufPtr = Pcount3DDemo_uartTxBufAppend(bufPtr, (void *)&(gMmwMssMCB.timingHist), timingHistLength);
+
+            memset((void *)&gMmwMssMCB.timingHist, 0, sizeof(Pcount3DDemo_output_message_timingHist));
+            gMmwMssMCB.timingHistNumFrames = 0;
         }
-        /* Send padding bytes */
+        /* Padding bytes */
         numPaddingBytes = MMWDEMO_OUTPUT_MSG_SEGMENT_LEN - (packetLen & (MMWDEMO_OUTPUT_MSG_SEGMENT_LEN-1));
         if (numPaddingBytes<MMWDEMO_OUTPUT_MSG_SEGMENT_LEN)
         {
-            UART_writePolling (uartHandle,
-                                (uint8_t*)padding,
-                                numPaddingBytes);
+            memset((void *)bufPtr, 0, numPaddingBytes);
+            bufPtr += numPaddingBytes;
         }
+        DebugP_assert((uint32_t)(bufPtr - gMmwMssMCB.uartTxBuf) == header.totalPacketLen);
+
+        /* Send the packet */
+        UART_write(uartHandle, gMmwMssMCB.uartTxBuf, header.totalPacketLen);
         gMmwMssMCB.uartProcessingTimeInUsec = (Cycleprofiler_getTimeStamp() - startTime) / R4F_CLOCK_MHZ;
     }
 }
@@ -1255,6 +1463,9 @@ static void Pcount3DDemo_dataPathStart(void)
     pointCloudSize                       = MAX_RESOLVED_OBJECTS_PER_FRAME * sizeof(DPIF_PointCloudSpherical);
     gMmwMssMCB.pointCloudFromDSP         = (DPIF_PointCloudSpherical *)MemoryP_ctrlAlloc(pointCloudSize, sizeof(float));
     gMmwMssMCB.pointCloudSideInfoFromDSP = (DPIF_PointCloudSideInfo *)MemoryP_ctrlAlloc(MAX_RESOLVED_OBJECTS_PER_FRAME * sizeof(DPIF_PointCloudSideInfo), sizeof(int16_t));
+    gMmwMssMCB.uartTxBufSize             = Pcount3DDemo_getUartTxBufSize();
+    gMmwMssMCB.uartTxBuf                 = (uint8_t *)MemoryP_ctrlAlloc(gMmwMssMCB.uartTxBufSize, sizeof(uint32_t));
+    DebugP_assert(gMmwMssMCB.uartTxBuf != NULL);
 
     /* Start the DPM Profile: */
     if ((retVal = DPM_start(gMmwMssMCB.objDetDpmHandle)) < 0)
@@ -1287,6 +1498,7 @@ static void Pcount3DDemo_dataPathStop(void)
 
     pointCloudSize = MAX_RESOLVED_OBJECTS_PER_FRAME * sizeof(DPIF_PointCloudSpherical);
     MemoryP_ctrlFree(gMmwMssMCB.pointCloudFromDSP, pointCloudSize);
+    MemoryP_ctrlFree(gMmwMssMCB.uartTxBuf, gMmwMssMCB.uartTxBufSize);
 
     retVal = DPM_stop(gMmwMssMCB.objDetDpmHandle);
     if (retVal < 0)
@@ -1734,14 +1946,7 @@ static void Pcount3DDemo_handleObjectDetResult(
     gMmwMssMCB.numDetectedPoints                        = outputFromDSP->pointCloudOut.object_count;
     for (pntIdx = 0; pntIdx < (int32_t)outputFromDSP->pointCloudOut.object_count; pntIdx++)
     {
-        // output to host
-        gMmwMssMCB.pointCloudToUart.point[pntIdx].azimuth   = (int8_t)round(outputFromDSP->pointCloudOut.pointCloud[pntIdx].azimuthAngle / gMmwMssMCB.pointCloudToUart.pointUint.azimuthUnit);
-        gMmwMssMCB.pointCloudToUart.point[pntIdx].elevation = (int8_t)round((outputFromDSP->pointCloudOut.pointCloud[pntIdx].elevAngle) / gMmwMssMCB.pointCloudToUart.pointUint.elevationUnit);
-        gMmwMssMCB.pointCloudToUart.point[pntIdx].range     = (uint16_t)round(outputFromDSP->pointCloudOut.pointCloud[pntIdx].range / gMmwMssMCB.pointCloudToUart.pointUint.rangeUnit);
-        gMmwMssMCB.pointCloudToUart.point[pntIdx].doppler   = (int16_t)round(outputFromDSP->pointCloudOut.pointCloud[pntIdx].velocity / gMmwMssMCB.pointCloudToUart.pointUint.dopplerUnit);
-        gMmwMssMCB.pointCloudToUart.point[pntIdx].snr       = (uint16_t)round((float)outputFromDSP->pointCloudOut.snr[pntIdx].snr * 0.125f / gMmwMssMCB.pointCloudToUart.pointUint.snrUint);
-
-        // future tracker input
+        // tracker input, compressed for the host by Pcount3DDemo_packPointCloud in the UART task
         gMmwMssMCB.pointCloudFromDSP[pntIdx].azimuthAngle = outputFromDSP->pointCloudOut.pointCloud[pntIdx].azimuthAngle; // - gMmwMssMCB.trackerCfg.trackerDpuCfg.staticCfg.sensorAzimuthTilt;
         gMmwMssMCB.pointCloudFromDSP[pntIdx].elevAngle    = outputFromDSP->pointCloudOut.pointCloud[pntIdx].elevAngle;
         gMmwMssMCB.pointCloudFromDSP[pntIdx].range        = outputFromDSP->pointCloudOut.pointCloud[pntIdx].range;
@@ -1831,24 +2036,34 @@ static void Pcount3DDemo_handleObjectDetResult(
      *****************************************************************/
     if (numSubFrames > 1)
     {
+        Pcount3DDemo_SubFrameCfg *currSubFrameCfg;
         Pcount3DDemo_SubFrameCfg *nextSubFrameCfg;
         uint16_t                  dummyRxChanOffset[SYS_COMMON_NUM_RX_CHANNEL];
 
         startTime = Cycleprofiler_getTimeStamp();
 
+        currSubFrameCfg = &gMmwMssMCB.subFrameCfg[currSubFrameIdx];
         nextSubFrameCfg = &gMmwMssMCB.subFrameCfg[nextSubFrameIdx];
 
-        /* Configure ADC for next sub-frame */
-        retVal = MmwDemo_ADCBufConfig(gMmwMssMCB.adcBufHandle,
-                                      gMmwMssMCB.cfg.openCfg.chCfg.rxChannelEn,
-                                      nextSubFrameCfg->numChirpsPerChirpEvent,
-                                      nextSubFrameCfg->adcBufChanDataSize,
-                                      &nextSubFrameCfg->adcBufCfg,
-                                      &dummyRxChanOffset[0]);
-        if (retVal < 0)
+        /* Configure ADC for next sub-frame. The ADC buffer holds the configuration of the
+         * current sub-frame, which is set before sensor start only, so it does not need
+         * to be reprogrammed if the next sub-frame uses the same one. */
+        if ((currSubFrameCfg->numChirpsPerChirpEvent != nextSubFrameCfg->numChirpsPerChirpEvent) ||
+            (currSubFrameCfg->adcBufChanDataSize != nextSubFrameCfg->adcBufChanDataSize) ||
+            (memcmp((void *)&currSubFrameCfg->adcBufCfg, (void *)&nextSubFrameCfg->adcBufCfg,
+                    sizeof(MmwDemo_ADCBufCfg)) != 0))
         {
-            System_printf("Error: ADCBuf config failed with error[%d]\n", retVal);
-            Pcount3DDemo_debugAssert(0);
+            retVal = MmwDemo_ADCBufConfig(gMmwMssMCB.adcBufHandle,
+                                          gMmwMssMCB.cfg.openCfg.chCfg.rxChannelEn,
+                                          nextSubFrameCfg->numChirpsPerChirpEvent,
+                                          nextSubFrameCfg->adcBufChanDataSize,
+                                          &nextSubFrameCfg->adcBufCfg,
+                                          &dummyRxChanOffset[0]);
+            if (retVal < 0)
+            {
+                System_printf("Error: ADCBuf config failed with error[%d]\n", retVal);
+                Pcount3DDemo_debugAssert(0);
+            }
         }
 
         currSubFrameStats->subFramePreparationTime = (Cycleprofiler_getTimeStamp() - startTime) / R4F_CLOCK_MHZ;
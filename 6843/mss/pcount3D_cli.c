@@ -92,6 +92,7 @@ static int32_t Pcount3DDemo_CLISensorStop(int32_t argc, char *argv[]);
 static int32_t Pcount3DDemo_CLIADCBufCfg(int32_t argc, char *argv[]);
 static int32_t Pcount3DDemo_CLIBpmCfg(int32_t argc, char *argv[]);
 static int32_t Pcount3DDemo_CLICompRangeBiasAndRxChanPhaseCfg(int32_t argc, char *argv[]);
+static int32_t Pcount3DDemo_CLITimingHistCfg(int32_t argc, char *argv[]);
 
 static int32_t Pcount3DDemo_CLIResetDevice(int32_t argc, char *argv[]);
 
@@ -996,6 +997,48 @@ static int32_t Pcount3DDemo_CLICompRangeBiasAndRxChanPhaseCfg(int32_t argc, char
     return 0;
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the timing histogram report. The histograms
+ *      are cleared and sent every reportPeriod frames, 0 disables the report.
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t Pcount3DDemo_CLITimingHistCfg(int32_t argc, char *argv[])
+{
+    int32_t reportPeriod;
+
+    /* Sanity Check: Minimum argument check */
+    if (argc != 2)
+    {
+        CLI_write("Error: Invalid usage of the CLI command\n");
+        return -1;
+    }
+
+    /* Bucket counts are 16 bits */
+    reportPeriod = atoi(argv[1]);
+    if ((reportPeriod < 0) || (reportPeriod > 0xFFFF))
+    {
+        CLI_write("Error: reportPeriod must be in [0, 65535]\n");
+        return -1;
+    }
+
+    /* The histograms are cleared by the UART task, which may be updating them */
+    gMmwMssMCB.timingHistReportPeriod = (uint16_t)reportPeriod;
+    gMmwMssMCB.timingHistResetReq     = true;
+
+    return 0;
+}
+
 /**
  *  @b Description
  *  @n
@@ -1281,6 +1324,11 @@ void Pcount3DDemo_CLIInit(uint8_t taskPriority)
     cliCfg.tableEntry[cnt].cmdHandlerFxn = Pcount3DDemo_CLICompRangeBiasAndRxChanPhaseCfg;
     cnt++;
 
+    cliCfg.tableEntry[cnt].cmd           = "timingHistCfg";
+    cliCfg.tableEntry[cnt].helpString    = "<reportPeriod>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn = Pcount3DDemo_CLITimingHistCfg;
+    cnt++;
+
     cliCfg.tableEntry[cnt].cmd           = "resetDevice";
     cliCfg.tableEntry[cnt].helpString    = "No arguments";
     cliCfg.tableEntry[cnt].cmdHandlerFxn = Pcount3DDemo_CLIResetDevice;
@@ -121,6 +121,69 @@ extern "C"
 
     /** @}*/ /* configStoreOffsets */
 
+/*! @brief TLV type of the timing histogram report @ref Pcount3DDemo_output_message_timingHist */
+#define MMWDEMO_OUTPUT_MSG_TIMING_HISTOGRAM 1100
+
+/*! @brief Number of buckets of a timing histogram. Bucket 0 counts times below 2 usec,
+ *         bucket k>0 counts times in [2^k, 2^(k+1)) usec and the last bucket also counts
+ *         all longer times. */
+#define PCOUNT3DDEMO_TIMING_HIST_NUM_BUCKETS 20U
+
+    /**
+     * @brief
+     *  Processing stages with a timing histogram
+     */
+    typedef enum Pcount3DDemo_TimingStage_e
+    {
+        /*! @brief  DSP processing during the active frame (chirping) period */
+        Pcount3DDemo_TimingStage_DSP_ACTIVE_FRAME = 0,
+
+        /*! @brief  DSP inter-frame processing, i.e the capon chain */
+        Pcount3DDemo_TimingStage_DSP_INTER_FRAME,
+
+        /*! @brief  Tracker DPU on the MSS */
+        Pcount3DDemo_TimingStage_TRACKER,
+
+        /*! @brief  UART transmission of the previous frame output, recorded with the other stages of a frame */
+        Pcount3DDemo_TimingStage_UART_TX,
+
+        /*! @brief  Number of stages */
+        Pcount3DDemo_TimingStage_NUM_STAGES
+    } Pcount3DDemo_TimingStage;
+
+    /**
+     * @brief
+     *  Log2 bucket histogram of the processing time of one stage
+     */
+    typedef struct Pcount3DDemo_TimingHist_t
+    {
+        /*! @brief  Median time in usec, upper bound of the bucket holding it */
+        uint32_t p50;
+
+        /*! @brief  99th percentile time in usec, upper bound of the bucket holding it */
+        uint32_t p99;
+
+        /*! @brief  Maximum time in usec */
+        uint32_t max;
+
+        /*! @brief  Number of times recorded */
+        uint32_t numSamples;
+
+        /*! @brief  Number of times recorded in each bucket */
+        uint16_t bucket[PCOUNT3DDEMO_TIMING_HIST_NUM_BUCKETS];
+    } Pcount3DDemo_TimingHist;
+
+    /**
+     * @brief
+     *  Payload of the @ref MMWDEMO_OUTPUT_MSG_TIMING_HISTOGRAM TLV, the histograms of
+     *  the frames since the previous report
+     */
+    typedef struct Pcount3DDemo_output_message_timingHist_t
+    {
+        /*! @brief  Histogram of each stage, indexed by @ref Pcount3DDemo_TimingStage */
+        Pcount3DDemo_TimingHist stage[Pcount3DDemo_TimingStage_NUM_STAGES];
+    } Pcount3DDemo_output_message_timingHist;
+
     /**
      * @brief
      *  3D people counting Demo Sensor State
@@ -385,6 +448,24 @@ extern "C"
         uint32_t                      trackerProcessingTimeInUsec;
         uint32_t                      uartProcessingTimeInUsec;
 
+        /*! @brief   Timing histograms of the frames since the last report */
+        Pcount3DDemo_output_message_timingHist timingHist;
+
+        /*! @brief   Frames between timing histogram reports, 0 disables the report */
+        uint16_t timingHistReportPeriod;
+
+        /*! @brief   Frames recorded in @ref timingHist */
+        uint16_t timingHistNumFrames;
+
+        /*! @brief   Set by the CLI to have the UART task clear @ref timingHist,
+         *           which only that task updates */
+        volatile bool timingHistResetReq;
+
+        /*! @brief   Buffer in which a UART packet is assembled before it is sent */
+        uint8_t *uartTxBuf;
+
+        /*! @brief   Size of @ref uartTxBuf in bytes */
+        uint32_t uartTxBufSize;
 
         /*! @brief      Task handle storage */
         Pcount3DDemo_taskHandles taskHandles;
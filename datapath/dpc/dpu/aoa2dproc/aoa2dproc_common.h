@@ -106,6 +106,10 @@
  *    5. EDMA copies HWA detected peaks from HWA memory to the local core memory.
  * 4. CPU selects the highest peak/peaks, and performs the final x/y/z calculation.
  *    The calculated data of detected objects are appended to the output lists.
+ *    When angle zoom refinement is enabled (@ref DPU_AoAProc_AngleZoomCfg), the angle
+ *    of each selected peak is first refined by evaluating the angle spectrum of the Doppler
+ *    compensated symbols on a finer grid around the coarse HWA FFT peak, using sine/cosine
+ *    tables generated once per zoom factor.
  *
  * One HWA loop iteration processes 2 detected objects. If the number of detected objects is odd, a
  * dummy one is appended at the end of the list of detected points. It is processed by HWA, but at the
@@ -309,6 +313,10 @@
  * detected list @ref DPU_AoAProcHWA_CfarDetOutput_t and for each detected peak it
  * forms a kernel of size 5x5, fills the kernel with peaks from the input list, and
  * it qualifies the peak if it is greater than all the peaks found in the kernel.
+ * The CFAR list is in the order of the CFAR iterations, so the start of the peaks of
+ * every iteration is recorded in a small table, the kernel is filled by scanning only
+ * the peaks of the 5 neighboring iterations, and the processing time grows linearly
+ * with the number of CFAR peaks.
  * The kernel size could have been set to 3x3, but because of the HWA peak grouping issue 
  * in xwr18xx (bug fixed in xwr68xx ES2.0), it is set to 5x5 to avoid breaking the 
  * sequences of neighboring peaks. 
@@ -324,7 +332,9 @@
  *
  * The selection of N highest peaks is performed by @ref AoAProcHWA_SelectMaxPeaks .
  * This function sorts the selected peaks and copies the specified number of highest
- * peaks to the output list of type @ref DPU_AoAProcHWA_CfarDetOutput.
+ * peaks to the output list of type @ref DPU_AoAProcHWA_CfarDetOutput. The highest
+ * peaks are picked by @ref AoAProcHWA_topKPeaks, which keeps a heap of the K best
+ * candidates in a single pass over the list.
  * The number highest peaks is set by
  * @ref DPU_AOAPROCHWA_MAX_NUM_EXPORTED_TARGETS_PER_RANGE_DOPPLER_PT .
  *
@@ -647,6 +657,36 @@ typedef struct DPU_AoAProc_StaticClutterRemovalCfg_t
     bool  isEnabled;
 }DPU_AoAProc_StaticClutterRemovalCfg;
 
+/**
+ * @brief
+ *  2D angle estimation zoom refinement configuration
+ *
+ * @details
+ *  The structure contains the configuration of the angle refinement performed
+ *  around each exported peak of the 2D angle FFT. The HWA angle FFT of
+ *  @ref DPU_AOAPROCHWA_NUM_ANGLE_BINS bins is used as a coarse stage, after which
+ *  the angle spectrum is evaluated by the local core on a grid zoomFactor times
+ *  finer, over the neighbourhood of the coarse peak, first in azimuth and then
+ *  in elevation.
+ *  The refinement only improves the angle accuracy of the exported points, the
+ *  detection, peak grouping and heatmap still use the coarse FFT, and it adds
+ *  local core cycles per exported point. It needs the angle zoom table
+ *  @ref DPU_AoAProcHWA_HW_Resources::angleZoomTable of numAngleBins*zoomFactor
+ *  floats, which the caller provides only if the refinement is used.
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProc_AngleZoomCfg_t
+{
+    /*! @brief    enabled flag:  1-enabled 0-disabled */
+    uint8_t     enabled;
+
+    /*! @brief    Zoom factor, number of fine bins per coarse angle bin. Must be a
+     *            power of 2 in the range 2 to @ref DPU_AOAPROCHWA_MAX_ANGLE_ZOOM_FACTOR */
+    uint8_t     zoomFactor;
+
+} DPU_AoAProc_AngleZoomCfg;
+
 /**
  * @brief
  *  AoAProc dynamic configuration
@@ -675,6 +715,9 @@ typedef struct DPU_AoAProc_DynamicConfig_t
     /** @brief      Extended maximum velocity configuration */
     DPU_AoAProc_ExtendedMaxVelocityCfg *extMaxVelCfg;
 
+    /** @brief      Angle zoom refinement configuration, NULL if not used */
+    DPU_AoAProc_AngleZoomCfg *angleZoomCfg;
+
     /*! @brief Static clutter removal configuration. Valid only for DSP version of the AoA DPU.*/
     DPU_AoAProc_StaticClutterRemovalCfg  staticClutterCfg;
 } DPU_AoAProc_DynamicConfig;
@@ -144,6 +144,13 @@ extern "C" {
 #define DPU_AOAPROCHWA_NUM_LOCAL_SCRATCH_BUFFER_SIZE_BYTES(numTxAntennas) \
     (DPU_AOAPROCHWA_MAX_NUM_CFAR_DET_PEAKS * sizeof(DPU_AoAProcHWA_CfarDetOutput))
 
+/*! @brief Maximum zoom factor of the 2D angle refinement, see @ref DPU_AoAProc_AngleZoomCfg */
+#define DPU_AOAPROCHWA_MAX_ANGLE_ZOOM_FACTOR (8)
+
+/*! @brief Number of elements of the angle zoom refinement table, see
+ *         @ref DPU_AoAProcHWA_HW_Resources::angleZoomTable */
+#define DPU_AOAPROCHWA_ANGLE_ZOOM_TABLE_SIZE(zoomFactor) (DPU_AOAPROCHWA_NUM_ANGLE_BINS * (zoomFactor))
+
 /*! @brief Maximum number of selected targets per range/Doppler detected point */
 #define DPU_AOAPROCHWA_MAX_NUM_EXPORTED_TARGETS_PER_RANGE_DOPPLER_PT (3)
 
@@ -234,6 +241,11 @@ extern "C" {
  */
 #define DPU_AOAPROCHWA_ENOMEMALIGN_RADAR_CUBE  (DP_ERRNO_AOA_PROC_BASE-32)
 
+/**
+ * @brief   Error Code: Insufficient memory allocated for @ref DPU_AoAProcHWA_HW_Resources::angleZoomTable
+ */
+#define DPU_AOAPROCHWA_ENOMEM__ANGLE_ZOOM_TABLE  (DP_ERRNO_AOA_PROC_BASE-33)
+
 /**
  * @brief   Error Code: Internal error
  */
@@ -273,7 +285,9 @@ typedef enum DPU_AoAProcHWA_Cmd_e
  /*! @brief     Command to update Azimuth heat-map configuration */
  DPU_AoAProcHWA_Cmd_PrepareRangeAzimuthHeatMap,
  /*! @brief     Command to update field of extended maximum velocity */
- DPU_AoAProcHWA_Cmd_ExtMaxVelocityCfg
+ DPU_AoAProcHWA_Cmd_ExtMaxVelocityCfg,
+ /*! @brief     Command to update angle zoom refinement configuration */
+ DPU_AoAProcHWA_Cmd_AngleZoomCfg
 } DPU_AoAProcHWA_Cmd;
 
 /*!
@@ -536,6 +550,17 @@ typedef struct DPU_AoAProcHWA_Resources_t
                     been provided for calculating this size */
     uint32_t        localScratchBufferSizeBytes;
 
+    /*! @brief      Cosine table of the angle zoom refinement, cos(2*pi*m/(numAngleBins*zoomFactor)),
+     *              m = 0,...,numAngleBins*zoomFactor-1, the sine is read from the same table
+     *              shifted by a quarter period. The table is generated by the DPU. It is needed only
+     *              if the refinement is enabled, otherwise it can be NULL. */
+    float           *angleZoomTable;
+
+    /*! @brief      Number of elements of angleZoomTable. It limits the zoom factor of the refinement,
+     *              a convenient macro @ref DPU_AOAPROCHWA_ANGLE_ZOOM_TABLE_SIZE has been provided for
+     *              calculating this size */
+    uint32_t        angleZoomTableSize;
+
 } DPU_AoAProcHWA_HW_Resources;
 
 /**
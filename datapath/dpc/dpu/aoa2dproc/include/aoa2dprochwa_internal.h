@@ -113,6 +113,9 @@ typedef struct DPU_AoAProc_DynamicLocalConfig_t
     /** @brief      Extended maximum velocity configuration */
     DPU_AoAProc_ExtendedMaxVelocityCfg extMaxVelCfg;
 
+    /** @brief      Angle zoom refinement configuration */
+    DPU_AoAProc_AngleZoomCfg angleZoomCfg;
+
 } DPU_AoAProc_DynamicLocalConfig;
 
 /** @addtogroup DPU_AOAPROC_INTERNAL_DEFINITION
@@ -243,8 +246,40 @@ typedef struct AOAHwaObj_t
     /*! @brief     Maximum number of expected peaks in 2D angle FFT output in selected direction direction azimuth or elevation  */
     uint16_t maxNumExpectedPeaks;
 
+    /*! @brief     Doppler compensated virtual antenna symbols saved per ping/pong for the
+     *             angle zoom refinement, (the 2D angle FFT input is overlaid by the HWA CFAR
+     *             output in the local scratch buffer) */
+    cmplx16ImRe_t angleZoomSymbols[AOAHWA_NUM_PING_PONG_BUF][DPU_AOAPROCHWA_MAX_NUM_RX_VIRTUAL_ANTENNAS];
+
+    /*! @brief     Zoom factor the angle zoom table in @ref DPU_AoAProcHWA_HW_Resources::angleZoomTable
+     *             is generated for, zero if not generated */
+    uint8_t angleZoomTableFactor;
+
 }AOAHwaObj;
 
+uint32_t AoAProcHWA_maxPeak(DPU_AoAProcHWA_CfarDetOutput * detList,
+                            uint32_t numPeaks);
+
+uint32_t AoAProcHWA_topKPeaks(DPU_AoAProcHWA_CfarDetOutput * detList,
+                              uint16_t *inIdxList,
+                              uint32_t numInputPeaks,
+                              uint32_t k,
+                              uint16_t *topIdxList);
+
+uint32_t AoAProcHWA_SelectMaxPeaks(DPU_AoAProcHWA_CfarDetOutput * detList,
+                                   uint16_t *inIdxList,
+                                   uint32_t numInputPeaks,
+                                   DPU_AoAProcHWA_CfarDetOutput * outList,
+                                   float thresholdScal,
+                                   uint32_t maxNumOutPeaks);
+
+uint32_t AoAProcHWA_peakGrouping(DPU_AoAProcHWA_CfarDetOutput * detList,
+                                 uint32_t numDetectedObjects,
+                                 uint32_t maxGroupedObjs,
+                                 uint16_t numAngleBins,
+                                 float thresholdScal,
+                                 uint16_t * outIdxList);
+
 #ifdef __cplusplus
 }
 #endif
@@ -174,13 +174,247 @@ void AoAProcHWA_rxChanPhaseBiasCompensation(AOAHwaObj *aoaHwaObj,
     }
 }
 
+/**
+ *   @b Description
+ *   @n
+ *      Function returns the peak value of the list entry at the given position.
+ *      When the index list is not provided the position indexes detList directly.
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static uint32_t AoAProcHWA_listPeak(DPU_AoAProcHWA_CfarDetOutput * detList,
+                                    uint16_t *inIdxList,
+                                    uint32_t pos)
+{
+    if (inIdxList != NULL)
+    {
+        pos = inIdxList[pos];
+    }
+    return detList[pos].peak;
+}
+
+/**
+ *   @b Description
+ *   @n
+ *      Function returns 1 if the peak at list position posA is ranked below the
+ *      peak at list position posB. Peaks are ranked by value, and equal peaks
+ *      by position, where the lower position is ranked higher.
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static uint32_t AoAProcHWA_peakRankedBelow(DPU_AoAProcHWA_CfarDetOutput * detList,
+                                           uint16_t *inIdxList,
+                                           uint32_t posA,
+                                           uint32_t posB)
+{
+    uint32_t peakA = AoAProcHWA_listPeak(detList, inIdxList, posA);
+    uint32_t peakB = AoAProcHWA_listPeak(detList, inIdxList, posB);
+
+    return ((peakA < peakB) || ((peakA == peakB) && (posA > posB)));
+}
+
+/**
+ *   @b Description
+ *   @n
+ *      Function restores the heap property of the heap of list positions,
+ *      where the root holds the lowest ranked peak, by moving the entry at
+ *      heap position pos down the heap.
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static void AoAProcHWA_peakHeapSiftDown(DPU_AoAProcHWA_CfarDetOutput * detList,
+                                        uint16_t *inIdxList,
+                                        uint16_t *heap,
+                                        uint32_t heapSize,
+                                        uint32_t pos)
+{
+    uint32_t child;
+    uint16_t tmp;
+
+    while ((child = 2 * pos + 1) < heapSize)
+    {
+        if ((child + 1 < heapSize) &&
+            AoAProcHWA_peakRankedBelow(detList, inIdxList, heap[child + 1], heap[child]))
+        {
+            child++;
+        }
+        if (!AoAProcHWA_peakRankedBelow(detList, inIdxList, heap[child], heap[pos]))
+        {
+            break;
+        }
+        tmp = heap[pos];
+        heap[pos] = heap[child];
+        heap[child] = tmp;
+        pos = child;
+    }
+}
+
+/**
+ *   @b Description
+ *   @n
+ *      Function returns the value of the maximum peak in the list. The list
+ *      is scanned with two independent running maximums so the compiler
+ *      can pipeline the loop.
+ *
+ * @param[in]      detList List of peaks
+ *
+ * @param[in]      numPeaks Number of peaks in detList
+ *
+ * @return         Maximum peak value, 0 if the list is empty
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+uint32_t AoAProcHWA_maxPeak(DPU_AoAProcHWA_CfarDetOutput * detList,
+                            uint32_t numPeaks)
+{
+    uint32_t i;
+    uint32_t peak0 = 0;
+    uint32_t peak1 = 0;
+    uint32_t peak;
+
+    for (i = 0; i + 1 < numPeaks; i += 2)
+    {
+        peak = detList[i].peak;
+        peak0 = (peak > peak0) ? peak : peak0;
+        peak = detList[i + 1].peak;
+        peak1 = (peak > peak1) ? peak : peak1;
+    }
+    if (i < numPeaks)
+    {
+        peak = detList[i].peak;
+        peak0 = (peak > peak0) ? peak : peak0;
+    }
+    return (peak0 > peak1) ? peak0 : peak1;
+}
+
+/**
+ *   @b Description
+ *   @n
+ *      Function selects the K highest peaks from the input list and returns
+ *      their indices in descending order of the peak value. Equal peaks are
+ *      returned in the order of the input list. The selection keeps a heap
+ *      of the K best candidates, so the cost is O(N log K) instead of O(N K)
+ *      of repeated list scans. For K equal to 1 the heap is skipped and the
+ *      list is scanned once for the maximum.
+ *
+ * @param[in]      detList List of peaks generated by HWA CFAR
+ *
+ * @param[in]      inIdxList Index list pointing to the candidate peaks in detList.
+ *                           If NULL, the candidates are the first numInputPeaks
+ *                           entries of detList.
+ *
+ * @param[in]      numInputPeaks Number of candidate peaks
+ *
+ * @param[in]      k Number of peaks to select
+ *
+ * @param[out]     topIdxList Indices in detList of the selected peaks, highest
+ *                            first. Must hold k entries.
+ *
+ * @return         Number of selected peaks, min(k, numInputPeaks)
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+uint32_t AoAProcHWA_topKPeaks(DPU_AoAProcHWA_CfarDetOutput * detList,
+                              uint16_t *inIdxList,
+                              uint32_t numInputPeaks,
+                              uint32_t k,
+                              uint16_t *topIdxList)
+{
+    uint32_t i, pos, parent;
+    uint32_t peak, peakMax;
+    uint16_t tmp;
+
+    if (k > numInputPeaks)
+    {
+        k = numInputPeaks;
+    }
+    if (k == 0)
+    {
+        goto exit;
+    }
+
+    if (k == 1)
+    {
+        /* Single maximum, the first of equal peaks wins */
+        pos = 0;
+        peakMax = AoAProcHWA_listPeak(detList, inIdxList, 0);
+        for (i = 1; i < numInputPeaks; i++)
+        {
+            peak = AoAProcHWA_listPeak(detList, inIdxList, i);
+            if (peak > peakMax)
+            {
+                pos = i;
+                peakMax = peak;
+            }
+        }
+        topIdxList[0] = (uint16_t) pos;
+    }
+    else
+    {
+        /* Heap of the first k positions, lowest ranked peak in the root */
+        for (i = 0; i < k; i++)
+        {
+            topIdxList[i] = (uint16_t) i;
+            pos = i;
+            while (pos > 0)
+            {
+                parent = (pos - 1) >> 1;
+                if (!AoAProcHWA_peakRankedBelow(detList, inIdxList, topIdxList[pos], topIdxList[parent]))
+                {
+                    break;
+                }
+                tmp = topIdxList[pos];
+                topIdxList[pos] = topIdxList[parent];
+                topIdxList[parent] = tmp;
+                pos = parent;
+            }
+        }
+
+        /* Replace the root with every better candidate */
+        for (i = k; i < numInputPeaks; i++)
+        {
+            if (AoAProcHWA_peakRankedBelow(detList, inIdxList, topIdxList[0], i))
+            {
+                topIdxList[0] = (uint16_t) i;
+                AoAProcHWA_peakHeapSiftDown(detList, inIdxList, topIdxList, k, 0);
+            }
+        }
+
+        /* Sort the heap, the lowest ranked peaks are moved to the end */
+        for (i = k - 1; i > 0; i--)
+        {
+            tmp = topIdxList[0];
+            topIdxList[0] = topIdxList[i];
+            topIdxList[i] = tmp;
+            AoAProcHWA_peakHeapSiftDown(detList, inIdxList, topIdxList, i, 0);
+        }
+    }
+
+    if (inIdxList != NULL)
+    {
+        for (i = 0; i < k; i++)
+        {
+            topIdxList[i] = inIdxList[topIdxList[i]];
+        }
+    }
+
+exit:
+    return k;
+}
+
 /**
  *   @b Description
  *   @n
  *      Function picks maximum peaks from the input list in sorted order
  *      starting with the maximum peak fist. Input peaks are located in detList
  *      pointed by index list inIdxList. Selected highest peaks are
- *      copied to the output list outList.
+ *      copied to the output list outList. The peaks are selected by
+ *      @ref AoAProcHWA_topKPeaks.
  *
  * @param[in]      detList List of all peaks generated by HWA CFAR
  *
@@ -207,59 +441,40 @@ uint32_t AoAProcHWA_SelectMaxPeaks(DPU_AoAProcHWA_CfarDetOutput * detList,
                                    float thresholdScal,
                                    uint32_t maxNumOutPeaks)
 {
-    int32_t i, j;
+    uint32_t j;
     uint32_t numOutPeaks = 0;
-    uint32_t peakMax;
-    uint32_t peakMaxIdx;
-
-    /* Mask below holds selected peaks. 32 peaks is enough since the maximum
-     * number of grouped peaks is up to 32,
-     * see DPU_AOAPROCHWA_MAX_NUM_GROUPED_TARGETS_PER_RANGE_DOPPLER_PT */
-    uint32_t selectedBitMask = 0;
+    uint32_t numTopPeaks;
     uint32_t threshold;
+    uint16_t topIdxList[DPU_AOAPROCHWA_MAX_NUM_GROUPED_TARGETS_PER_RANGE_DOPPLER_PT];
 
     if (numInputPeaks ==  0)
     {
         goto exit;
     }
 
-    /* Find the highest peak */
-    peakMaxIdx = 0;
-    peakMax = 0;
-    for (i = 0; i < numInputPeaks; i++)
+    /* The maximum peak is always selected */
+    if (maxNumOutPeaks == 0)
     {
-        if (detList[inIdxList[i]].peak > peakMax)
-        {
-            peakMaxIdx = i;
-            peakMax = detList[inIdxList[i]].peak;
-        }
+        maxNumOutPeaks = 1;
+    }
+    if (maxNumOutPeaks > DPU_AOAPROCHWA_MAX_NUM_GROUPED_TARGETS_PER_RANGE_DOPPLER_PT)
+    {
+        maxNumOutPeaks = DPU_AOAPROCHWA_MAX_NUM_GROUPED_TARGETS_PER_RANGE_DOPPLER_PT;
     }
-    threshold = (uint32_t) (thresholdScal * (float) peakMax);
-    selectedBitMask |= 1 << peakMaxIdx;
-    outList[numOutPeaks++] = detList[inIdxList[peakMaxIdx]]; /*Copy maximum peak*/
 
-    /* Find the other peaks */
-    for (j = 1; j < maxNumOutPeaks; j++)
+    numTopPeaks = AoAProcHWA_topKPeaks(detList, inIdxList, numInputPeaks, maxNumOutPeaks, topIdxList);
+
+    threshold = (uint32_t) (thresholdScal * (float) detList[topIdxList[0]].peak);
+    outList[numOutPeaks++] = detList[topIdxList[0]]; /*Copy maximum peak*/
+
+    /* Additional peaks, in descending order */
+    for (j = 1; j < numTopPeaks; j++)
     {
-        peakMaxIdx = 0;
-        peakMax = 0;
-        for (i = 0; i < numInputPeaks; i++)
+        if (detList[topIdxList[j]].peak <= threshold)
         {
-            /* Skip already chosen peaks */
-            if ( !((selectedBitMask >> i) & 0x1) )
-            {
-                if (detList[inIdxList[i]].peak > peakMax)
-                {
-                    peakMaxIdx = i;
-                    peakMax = detList[inIdxList[i]].peak;
-                }
-            }
-        }
-        if(peakMax > threshold)
-        {
-            selectedBitMask |= 1 << peakMaxIdx;
-            outList[numOutPeaks++] = detList[inIdxList[peakMaxIdx]]; /*Additional peaks*/
+            break;
         }
+        outList[numOutPeaks++] = detList[topIdxList[j]];
     }
 
 exit:
@@ -271,10 +486,17 @@ exit:
  *   @n
  *      Function performs peak grouping on the HWA CFAR detection list, where
  *      CFAR is used to detect maximum peaks in two dimensional (azimuth/elevation)
- *      angle FFT output. The algorithm assumes that peaks in the list have
- *      coordinates, (iterNum, cellIdx) in increasing order, i.e. for every
- *      consecutive pair of points P(n), P(n+1) in the list the following holds:
- *      iterNum(n) <= iterNUm(n+1) and cellIdx(n) <= cellIdx(n+1)
+ *      angle FFT output. The HWA CFAR lists the peaks in the order of its
+ *      iterations, so the peaks of one iteration (iterNum) form a contiguous
+ *      run of the list. The start of every run is first recorded in a table
+ *      of numAngleBins + 1 entries. For every peak above the threshold only
+ *      the runs of the 5 neighboring iterations are then scanned for peaks
+ *      within +/-2 cells (with circular wrap around in both directions), so
+ *      the cost is linear in the number of detected peaks. The peak qualifies
+ *      if none of the peaks in its neighborhood is greater. The algorithm
+ *      assumes that the list is in the HWA CFAR output order (ascending
+ *      iterNum) and that the (iterNum, cellIdx) coordinates of the peaks are
+ *      unique, as produced by HWA CFAR.
  *
  * @param[in]      detList List of all peaks generated by HWA CFAR. When the CFAR
  *                         is performed in azimuth direction, the cellIdx field
@@ -288,7 +510,8 @@ exit:
  *
  * @param[in]      maxGroupedObjs Maximum number of output objects in the output list
  *
- * @param[out]     numAngleBins  Number of angle bins, (FFT size)
+ * @param[out]     numAngleBins  Number of angle bins, (FFT size), must be power of 2
+ *                               and not greater than @ref DPU_AOAPROCHWA_NUM_ANGLE_BINS
  *
  * @param[in]      thresholdScal Threshold scale (0-1) for selecting peaks
  *                               beside the maximum peak.
@@ -317,154 +540,84 @@ uint32_t AoAProcHWA_peakGrouping(DPU_AoAProcHWA_CfarDetOutput * detList,
     int32_t i, j, listIdx;
     uint32_t numObjOut = 0;
     int32_t cCol, cRow;
-    uint32_t discarded;
     uint16_t discardListCnt;
     int32_t mask = numAngleBins -1;
     uint16_t detectedObjFlag;
-    uint32_t kernel[KERNEL_SIZE * KERNEL_SIZE];
     uint16_t discardList[KERNEL_SIZE * KERNEL_SIZE];
-    int32_t tCol, tRow, kCol, kRow, mCol, mRow;
+    uint16_t rowStart[DPU_AOAPROCHWA_NUM_ANGLE_BINS + 1];
+    int32_t kRow, row, tCol;
     uint32_t threshold;
     uint32_t peakMax;
-    int32_t numHalfAngleBins = (numAngleBins >> 1);
+    uint32_t peakCut;
 
     /* Find the highest peak and set a threshold */
-    peakMax = 0;
-    for (i = 0; i < numDetectedObjects; i++)
+    peakMax = AoAProcHWA_maxPeak(detList, numDetectedObjects);
+    threshold = (uint32_t) (thresholdScal * (float) peakMax);
+
+    /* Peaks of the iteration row are detList[rowStart[row]],...,detList[rowStart[row + 1] - 1] */
+    listIdx = 0;
+    rowStart[0] = 0;
+    for (row = 0; row < numAngleBins; row++)
     {
-        if (detList[i].peak > peakMax)
+        while ((listIdx < (int32_t) numDetectedObjects) && ((int32_t) detList[listIdx].iterNum <= row))
         {
-            peakMax = detList[i].peak;
+            listIdx++;
         }
+        rowStart[row + 1] = (uint16_t) listIdx;
     }
-    threshold = (uint32_t) (thresholdScal * (float) peakMax);
 
     for (i = 0; i < numDetectedObjects; i++)
     {
-        if (detList[i].peak < threshold)
+        peakCut = detList[i].peak;
+        if (peakCut < threshold)
         {
             continue;
         }
         /* pull the point from the list, cell under test (CUT) */
         cCol = detList[i].cellIdx;
         cRow = detList[i].iterNum;
-        discarded = detList[i].reserved;
-        detectedObjFlag = 0;
+        detectedObjFlag = 1;
         discardListCnt = 0;
 
-        if (~discarded)
+        /* Compare the CUT to the peaks in its 5x5 neighborhood */
+        for (kRow = -KERNEL_MIDDLE; kRow <= KERNEL_MIDDLE; kRow++)
         {
-            detectedObjFlag = 1;
-
-            /* Fill the kernel with CUT, current row to the left of CUT, and the rows above the center row */
-            for (j = 0; j < numDetectedObjects; j++)
-            {
-                listIdx = i - j;
-                if (listIdx < 0)
-                {
-                    listIdx = listIdx + numDetectedObjects;
-                }
-
-                /* Row/col from the 2D FFT matrix: */
-                mCol = (int32_t) detList[listIdx].cellIdx;
-                mRow = (int32_t) detList[listIdx].iterNum;
-
-                /* Translated and made signed to CUT position: */
-                tCol = (mCol - cCol) & mask;
-                tRow = (mRow - cRow) & mask;
-                if (tCol >= numHalfAngleBins)
-                {
-                    tCol -= (int32_t) numAngleBins;
-                }
-                if (tRow >= numHalfAngleBins)
-                {
-                    tRow -= (int32_t) numAngleBins;
-                }
-
-                /* row/col in the kernel: */
-                kCol = tCol + KERNEL_MIDDLE;
-                kRow = tRow + KERNEL_MIDDLE;
-
-                if (kRow < 0)
-                {
-                    /* Stop search above this row */
-                    break;
-                }
-
-                if ((kCol >= 0) && (kCol < KERNEL_SIZE) && (kRow < KERNEL_SIZE)&& (discardListCnt < (KERNEL_SIZE*KERNEL_SIZE)))
-                {
-                    /* Place symbol in a kernel: */
-                    kernel[discardListCnt] = detList[listIdx].peak;
-                    discardList[discardListCnt++] = listIdx;
-                }
-            }
-
-           /* Fill the kernel current row to the right of CUT and rows below the center row */
-            for (j = 1; j < numDetectedObjects; j++)
+            row = (cRow + kRow) & mask;
+            for (listIdx = rowStart[row]; listIdx < rowStart[row + 1]; listIdx++)
             {
-                listIdx = i + j;
-                if (listIdx >= numDetectedObjects)
+                tCol = ((int32_t) detList[listIdx].cellIdx - cCol) & mask;
+                if ((tCol > KERNEL_MIDDLE) && (tCol < numAngleBins - KERNEL_MIDDLE))
                 {
-                    listIdx = listIdx - (int32_t) numDetectedObjects;
+                    continue;
                 }
-
-                mCol = (int32_t) detList[listIdx].cellIdx;
-                mRow = (int32_t) detList[listIdx].iterNum;
-
-                tCol = (mCol - cCol) & mask;
-                tRow = (mRow - cRow) & mask;
-                if (tCol >= numHalfAngleBins)
-                {
-                    tCol -= (int32_t) numAngleBins;
-                }
-                if (tRow >= numHalfAngleBins)
-                {
-                    tRow -= (int32_t) numAngleBins;
-                }
-
-                kCol = tCol + KERNEL_MIDDLE;
-                kRow = tRow + KERNEL_MIDDLE;
-
-                if (kRow > (KERNEL_SIZE -1))
-                {
-                    /* Stop search below this row */
-                    break;
-                }
-
-                if ((kCol >= 0) && (kCol < KERNEL_SIZE) && (kRow >= 0) && (discardListCnt < (KERNEL_SIZE*KERNEL_SIZE)))
-                {
-                    kernel[discardListCnt] = detList[listIdx].peak;
-                    discardList[discardListCnt++] = listIdx;
-                }
-            }
-
-            /* Compare the CUT (in kernel[0]) to its neighbors. */
-            for (j = 1; j < discardListCnt; j++)
-            {
-                if (kernel[j] > kernel[0]) // discardListCnt is always >= 1
+                if (detList[listIdx].peak > peakCut)
                 {
                     detectedObjFlag = 0;
                     break;
                 }
+                discardList[discardListCnt++] = listIdx;
             }
-
-            if (detectedObjFlag == 1)
+            if (detectedObjFlag == 0)
             {
-                /* CUT is local peak, put its index in the output index list */
-                outIdxList[numObjOut++] = i;
-                for (j = 0; j < discardListCnt; j++)
-                {
-                    /* mark all peaks from kernel as used (reserved) */
-                    detList[discardList[j]].reserved = 1;
-                }
+                break;
             }
+        }
 
-            if (numObjOut >= maxGroupedObjs)
+        if (detectedObjFlag == 1)
+        {
+            /* CUT is local peak, put its index in the output index list */
+            outIdxList[numObjOut++] = i;
+            for (j = 0; j < discardListCnt; j++)
             {
-                goto exit;
+                /* mark all peaks from kernel as used (reserved) */
+                detList[discardList[j]].reserved = 1;
             }
+        }
 
-        }/* end of if not discarded */
+        if (numObjOut >= maxGroupedObjs)
+        {
+            goto exit;
+        }
     }/* end of List scan */
 exit:
     return numObjOut;
@@ -2002,6 +2155,269 @@ int32_t AoAProcHWA_dataPathWait2DFFTDetObj(SemaphoreP_Handle semaHandle)
     return((int32_t) SemaphoreP_pend(semaHandle, SemaphoreP_WAIT_FOREVER));
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Checks the angle zoom refinement configuration. The zoom factor of the
+ *      enabled refinement must be a power of 2 in the range from 2 to
+ *      @ref DPU_AOAPROCHWA_MAX_ANGLE_ZOOM_FACTOR, and the angle zoom table
+ *      must be large enough for it.
+ *
+ *  @param[in]  cfg  Angle zoom refinement configuration
+ *
+ *  @param[in]  res  DPU hardware resources with the angle zoom table
+ *
+ *  @retval
+ *      Success     - 0
+ *  @retval
+ *      Error code  - <0
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static int32_t AoAProcHWA_angleZoomCfgCheck(DPU_AoAProc_AngleZoomCfg *cfg,
+                                            DPU_AoAProcHWA_HW_Resources *res)
+{
+    int32_t retVal = 0;
+
+    if (cfg->enabled)
+    {
+        if ((cfg->zoomFactor < 2) ||
+            (cfg->zoomFactor > DPU_AOAPROCHWA_MAX_ANGLE_ZOOM_FACTOR) ||
+            ((cfg->zoomFactor & (cfg->zoomFactor - 1)) != 0))
+        {
+            retVal = DPU_AOAPROCHWA_EINVAL;
+        }
+        else if ((res->angleZoomTable == NULL) ||
+                 (res->angleZoomTableSize < DPU_AOAPROCHWA_ANGLE_ZOOM_TABLE_SIZE(cfg->zoomFactor)))
+        {
+            retVal = DPU_AOAPROCHWA_ENOMEM__ANGLE_ZOOM_TABLE;
+        }
+    }
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Generates the cosine table of the angle zoom refinement,
+ *      cos(2*pi*m/(numAngleBins*zoomFactor)), m = 0,...,numAngleBins*zoomFactor-1.
+ *      The table is regenerated only when the zoom factor changes.
+ *
+ *  @param[in]  aoaHwaObj   Pointer to AoA DPU internal object
+ *
+ *  @param[in]  zoomFactor  Zoom factor
+ *
+ *  @retval None
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static void AoAProcHWA_angleZoomTableGen(AOAHwaObj *aoaHwaObj, uint8_t zoomFactor)
+{
+    uint32_t i;
+    uint32_t numFineBins = DPU_AOAPROCHWA_NUM_ANGLE_BINS * zoomFactor;
+
+    if (aoaHwaObj->angleZoomTableFactor == zoomFactor)
+    {
+        return;
+    }
+
+    for (i = 0; i < numFineBins; i++)
+    {
+        aoaHwaObj->res.angleZoomTable[i] = (float) cos(2 * PI_ * i / numFineBins);
+    }
+    aoaHwaObj->angleZoomTableFactor = zoomFactor;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Saves the Doppler compensated virtual antenna symbols for the angle zoom
+ *      refinement. The symbols are gathered from the 2D angle FFT input matrix
+ *      in the order of the virtual antennas, since the matrix is overwritten
+ *      by the list of HWA detected peaks before the refinement.
+ *
+ *  @param[in]  aoaHwaObj   Pointer to AoA DPU internal object
+ *
+ *  @param[in]  srcPtr      Pointer to 2D angle FFT input matrix
+ *
+ *  @param[in]  pingPongIdx ping/pong index
+ *
+ *  @retval None
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static void AoAProcHWA_angleZoomSaveSymbols
+(
+    AOAHwaObj *aoaHwaObj,
+    uint32_t *srcPtr,
+    uint8_t pingPongIdx
+)
+{
+    uint32_t virtAntIdx;
+    uint32_t numVirtAnt = aoaHwaObj->params.numTxAntennas * aoaHwaObj->params.numRxAntennas;
+    uint32_t *dstPtr = (uint32_t *) aoaHwaObj->angleZoomSymbols[pingPongIdx];
+
+    for (virtAntIdx = 0; virtAntIdx < numVirtAnt; virtAntIdx++)
+    {
+        dstPtr[virtAntIdx] = srcPtr[aoaHwaObj->antForwardMapLUT[virtAntIdx].rowIdx * aoaHwaObj->numAntCol +
+                                    aoaHwaObj->antForwardMapLUT[virtAntIdx].colIdx];
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Calculates the power of the 2D angle spectrum of the saved virtual antenna
+ *      symbols at the fine azimuth/elevation bin.
+ *
+ *  @param[in]  aoaHwaObj    Pointer to AoA DPU internal object
+ *
+ *  @param[in]  symb         Saved virtual antenna symbols
+ *
+ *  @param[in]  azimFineIdx  Azimuth fine bin index, 0,...,numAngleBins*zoomFactor-1
+ *
+ *  @param[in]  elevFineIdx  Elevation fine bin index, 0,...,numAngleBins*zoomFactor-1
+ *
+ *  @retval Spectrum power
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static float AoAProcHWA_angleZoomPower
+(
+    AOAHwaObj *aoaHwaObj,
+    cmplx16ImRe_t *symb,
+    uint32_t azimFineIdx,
+    uint32_t elevFineIdx
+)
+{
+    uint32_t virtAntIdx;
+    uint32_t numVirtAnt = aoaHwaObj->params.numTxAntennas * aoaHwaObj->params.numRxAntennas;
+    uint32_t numFineBins = DPU_AOAPROCHWA_NUM_ANGLE_BINS * aoaHwaObj->angleZoomTableFactor;
+    uint32_t mask = numFineBins - 1;
+    uint32_t phaseIdx;
+    float sumRe = 0, sumIm = 0;
+    float Cos, Sin;
+
+    for (virtAntIdx = 0; virtAntIdx < numVirtAnt; virtAntIdx++)
+    {
+        phaseIdx = (azimFineIdx * aoaHwaObj->antForwardMapLUT[virtAntIdx].colIdx +
+                    elevFineIdx * aoaHwaObj->antForwardMapLUT[virtAntIdx].rowIdx) & mask;
+        Cos = aoaHwaObj->res.angleZoomTable[phaseIdx];
+        /* sin(x) = cos(x - pi/2) */
+        Sin = aoaHwaObj->res.angleZoomTable[(phaseIdx - (numFineBins >> 2)) & mask];
+
+        /* symb * exp(-j*2*pi*phaseIdx/(numAngleBins*zoomFactor)) */
+        sumRe += symb[virtAntIdx].real * Cos + symb[virtAntIdx].imag * Sin;
+        sumIm += symb[virtAntIdx].imag * Cos - symb[virtAntIdx].real * Sin;
+    }
+    return (sumRe * sumRe + sumIm * sumIm);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Refines the azimuth/elevation position of the 2D angle FFT peak. The angle
+ *      spectrum is evaluated on the grid zoomFactor times finer than the HWA FFT,
+ *      over +/-(zoomFactor-1) fine bins around the coarse peak, first in azimuth
+ *      at the coarse elevation and then in elevation at the refined azimuth.
+ *
+ *  @param[in]  aoaHwaObj    Pointer to AoA DPU internal object
+ *
+ *  @param[in]  pingPongIdx  ping/pong index
+ *
+ *  @param[in]  azimIdx      Coarse azimuth index (signed)
+ *
+ *  @param[in]  elevIdx      Coarse elevation index (signed)
+ *
+ *  @param[out] azimBin      Refined azimuth index (signed, in units of coarse bins)
+ *
+ *  @param[out] elevBin      Refined elevation index (signed, in units of coarse bins)
+ *
+ *  @retval None
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static void AoAProcHWA_angleZoomRefine
+(
+    AOAHwaObj *aoaHwaObj,
+    uint8_t pingPongIdx,
+    int32_t azimIdx,
+    int32_t elevIdx,
+    float *azimBin,
+    float *elevBin
+)
+{
+    int32_t zoomFactor = aoaHwaObj->angleZoomTableFactor;
+    int32_t numFineBins = DPU_AOAPROCHWA_NUM_ANGLE_BINS * zoomFactor;
+    uint32_t mask = numFineBins - 1;
+    cmplx16ImRe_t *symb = aoaHwaObj->angleZoomSymbols[pingPongIdx];
+    uint32_t azimFineIdx, elevFineIdx, bestIdx, idx;
+    int32_t k, signedIdx;
+    float power, maxPower;
+
+    azimFineIdx = ((uint32_t) (azimIdx * zoomFactor)) & mask;
+    elevFineIdx = ((uint32_t) (elevIdx * zoomFactor)) & mask;
+
+    /* Azimuth */
+    bestIdx = azimFineIdx;
+    maxPower = AoAProcHWA_angleZoomPower(aoaHwaObj, symb, azimFineIdx, elevFineIdx);
+    for (k = 1 - zoomFactor; k < zoomFactor; k++)
+    {
+        if (k == 0)
+        {
+            continue;
+        }
+        idx = (azimFineIdx + k) & mask;
+        power = AoAProcHWA_angleZoomPower(aoaHwaObj, symb, idx, elevFineIdx);
+        if (power > maxPower)
+        {
+            maxPower = power;
+            bestIdx = idx;
+        }
+    }
+    azimFineIdx = bestIdx;
+
+    /* Elevation, at the refined azimuth */
+    if (aoaHwaObj->numAntRow > 1)
+    {
+        bestIdx = elevFineIdx;
+        for (k = 1 - zoomFactor; k < zoomFactor; k++)
+        {
+            if (k == 0)
+            {
+                continue;
+            }
+            idx = (elevFineIdx + k) & mask;
+            power = AoAProcHWA_angleZoomPower(aoaHwaObj, symb, azimFineIdx, idx);
+            if (power > maxPower)
+            {
+                maxPower = power;
+                bestIdx = idx;
+            }
+        }
+        elevFineIdx = bestIdx;
+    }
+
+    signedIdx = (int32_t) azimFineIdx;
+    if (signedIdx > (numFineBins/2 - 1))
+    {
+        signedIdx -= numFineBins;
+    }
+    *azimBin = (float) signedIdx / zoomFactor;
+
+    signedIdx = (int32_t) elevFineIdx;
+    if (signedIdx > (numFineBins/2 - 1))
+    {
+        signedIdx -= numFineBins;
+    }
+    *elevBin = (float) signedIdx / zoomFactor;
+}
+
 /**
  *  @b Description
  *  @n
@@ -2054,6 +2470,7 @@ uint32_t AoAProcHWA_XYZestimationAoA2D
     DPU_AoAProcHWA_CfarDetOutput *detList = (DPU_AoAProcHWA_CfarDetOutput *) aoaHwaObj->highestPeaksList;
     int32_t i;
     int32_t azimIdx, elevIdx;
+    float azimBin, elevBin;
     float lambdaOverDist = params->lambdaOverDist;
 
     range = objIn[objInIdx].rangeIdx * params->rangeStep;
@@ -2088,11 +2505,21 @@ uint32_t AoAProcHWA_XYZestimationAoA2D
             elevIdx = elevIdx - numAngleBins;
         }
 
-        Wx = 2 * (float) azimIdx / numAngleBins;
+        if (aoaHwaObj->dynLocalCfg.angleZoomCfg.enabled)
+        {
+            AoAProcHWA_angleZoomRefine(aoaHwaObj, pingPongIdx, azimIdx, elevIdx, &azimBin, &elevBin);
+        }
+        else
+        {
+            azimBin = (float) azimIdx;
+            elevBin = (float) elevIdx;
+        }
+
+        Wx = 2 * azimBin / numAngleBins;
 
         x = range * Wx * (lambdaOverDist/2);
 
-        Wz = 2 * (float) elevIdx / numAngleBins;;
+        Wz = 2 * elevBin / numAngleBins;
 
         /* Check if it is within configured field of view */
         if((((lambdaOverDist/2)*Wz) < aoaHwaObj->dynLocalCfg.fovAoaLocalCfg.minElevationSineVal) ||
@@ -2911,6 +3338,15 @@ int32_t DPU_AoAProcHWA_config
         goto exit;
     }
 
+    if (aoaHwaCfg->dynCfg.angleZoomCfg != NULL)
+    {
+        retVal = AoAProcHWA_angleZoomCfgCheck(aoaHwaCfg->dynCfg.angleZoomCfg, &aoaHwaCfg->res);
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+    }
+
     if (aoaHwaCfg->res.detObjOutMaxSize & 0x1)
     {
         retVal = DPU_AOAPROCHWA_EDETECTED_OBJECT_LIST_SIZE_ODD_NUMBER;
@@ -2969,6 +3405,21 @@ int32_t DPU_AoAProcHWA_config
 
     aoaHwaObj->dynLocalCfg.extMaxVelCfg = *aoaHwaCfg->dynCfg.extMaxVelCfg; //Currently not supported
 
+    if (aoaHwaCfg->dynCfg.angleZoomCfg != NULL)
+    {
+        aoaHwaObj->dynLocalCfg.angleZoomCfg = *aoaHwaCfg->dynCfg.angleZoomCfg;
+    }
+    else
+    {
+        memset((void *)&aoaHwaObj->dynLocalCfg.angleZoomCfg, 0, sizeof(DPU_AoAProc_AngleZoomCfg));
+    }
+    /* The table memory is provided again with each configuration */
+    aoaHwaObj->angleZoomTableFactor = 0;
+    if (aoaHwaObj->dynLocalCfg.angleZoomCfg.enabled)
+    {
+        AoAProcHWA_angleZoomTableGen(aoaHwaObj, aoaHwaObj->dynLocalCfg.angleZoomCfg.zoomFactor);
+    }
+
     /* Allocate buffers for ping and pong paths: */
     for (i = 0; i < DPU_AOAPROCHWA_NUM_LOCAL_SCRATCH_BUFFERS; i++)
     {
@@ -3206,6 +3657,13 @@ int32_t DPU_AoAProcHWA_process
                                            DPParams->numRxAntennas,
                                            DPParams->numDopplerBins);
 
+                if (aoaHwaObj->dynLocalCfg.angleZoomCfg.enabled)
+                {
+                    AoAProcHWA_angleZoomSaveSymbols(aoaHwaObj,
+                                                    aoaHwaObj->azimElevLocal2DimAngleFFTInput[pingPongIdx],
+                                                    pingPongIdx);
+                }
+
                 /* Trigger 3D-FFT */
                 AoAProcHWA_trigger_EDMA_3DFFT(aoaHwaObj, pingPongIdx);
             }
@@ -3329,6 +3787,31 @@ int32_t DPU_AoAProcHWA_control
            }
        }
        break;
+       case DPU_AoAProcHWA_Cmd_AngleZoomCfg:
+       {
+           if((argSize != sizeof(DPU_AoAProc_AngleZoomCfg)) ||
+              (arg == NULL))
+           {
+               retVal = DPU_AOAPROCHWA_EINVAL;
+               goto exit;
+           }
+           else
+           {
+               retVal = AoAProcHWA_angleZoomCfgCheck((DPU_AoAProc_AngleZoomCfg *) arg, &aoaHwaObj->res);
+               if (retVal != 0)
+               {
+                   goto exit;
+               }
+
+               /* Save configuration */
+               memcpy((void *)&aoaHwaObj->dynLocalCfg.angleZoomCfg, arg, argSize);
+               if (aoaHwaObj->dynLocalCfg.angleZoomCfg.enabled)
+               {
+                   AoAProcHWA_angleZoomTableGen(aoaHwaObj, aoaHwaObj->dynLocalCfg.angleZoomCfg.zoomFactor);
+               }
+           }
+       }
+       break;
        case DPU_AoAProcHWA_Cmd_CompRxChannelBiasCfg:
        {
            if((argSize != sizeof(DPU_AoAProc_compRxChannelBiasCfg)) ||
@@ -0,0 +1,503 @@
+/**
+ *   @file  aoa2dprochwa_test_main.c
+ *
+ *   @brief
+ *      Unit Test code for the 2D angle peak grouping of the aoa2dproc HWA DPU.
+ *      Random HWA CFAR detection lists are grouped by @ref AoAProcHWA_peakGrouping
+ *      and by a reference list scan. The test checks that the grouped index lists
+ *      and the reserved marking of the kernel peaks are identical, and reports the
+ *      cycles of both implementations.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2018 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+/* BIOS/XDC Include Files. */
+#include <xdc/std.h>
+#include <xdc/cfg/global.h>
+#include <xdc/runtime/System.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Task.h>
+#define DebugP_ASSERT_ENABLED 1
+#include <ti/drivers/osal/DebugP.h>
+#include <ti/common/sys_common.h>
+#include <ti/drivers/esm/esm.h>
+#include <ti/drivers/soc/soc.h>
+#include <ti/utils/testlogger/logger.h>
+#include <ti/utils/cycleprofiler/cycle_profiler.h>
+#include <ti/datapath/dpc/dpu/aoa2dproc/include/aoa2dprochwa_internal.h>
+
+/* Number of random CFAR lists per test configuration */
+#define TEST_NUM_RUNS 20
+
+/* Maximum number of peaks per CFAR iteration, as limited by the HWA CFAR configuration of the DPU */
+#define TEST_MAX_NUM_PEAKS_PER_ITER DPU_AOAPROCHWA_MAX_NUM_COL_IN_2D_ANGLE_FFT_INPUT
+
+/* Number of tested CFAR list densities */
+#define TEST_NUM_DENSITIES 4
+
+/* Number of tested threshold scales */
+#define TEST_NUM_THRESHOLDS 3
+
+SOC_Handle  socHandle;
+
+MCPI_LOGBUF_INIT(128);
+
+uint8_t finalResults;
+
+/* CFAR list generated by the test, and the copies processed by the two implementations */
+DPU_AoAProcHWA_CfarDetOutput testCfarList[DPU_AOAPROCHWA_MAX_NUM_CFAR_DET_PEAKS];
+DPU_AoAProcHWA_CfarDetOutput testRefList[DPU_AOAPROCHWA_MAX_NUM_CFAR_DET_PEAKS];
+DPU_AoAProcHWA_CfarDetOutput testDutList[DPU_AOAPROCHWA_MAX_NUM_CFAR_DET_PEAKS];
+
+/* Output index lists */
+uint16_t testRefIdxList[DPU_AOAPROCHWA_MAX_NUM_CFAR_DET_PEAKS];
+uint16_t testDutIdxList[DPU_AOAPROCHWA_MAX_NUM_CFAR_DET_PEAKS];
+
+/* Maximum number of peaks per CFAR iteration of the tested densities */
+const uint32_t testNumPeaksPerIter[TEST_NUM_DENSITIES] = {1, 2, 4, TEST_MAX_NUM_PEAKS_PER_ITER};
+
+/* Tested threshold scales */
+const float testThresholdScal[TEST_NUM_THRESHOLDS] = {0.f, 0.5f, 0.9f};
+
+/**
+*  @b Description
+*  @n
+*     Reference peak grouping. For every peak above the threshold the 5x5 kernel is
+*     filled by scanning the list backwards and forwards from the cell under test,
+*     which relies on the list being in the HWA CFAR output order. The cost grows
+*     with the square of the number of peaks.
+*
+*  @param[in]      detList            List of peaks generated by HWA CFAR
+*  @param[in]      numDetectedObjects Number of peaks in detList
+*  @param[in]      maxGroupedObjs     Maximum number of output objects
+*  @param[in]      numAngleBins       Number of angle bins, must be power of 2
+*  @param[in]      thresholdScal      Threshold scale (0-1) relative to the maximum peak
+*  @param[out]     outIdxList         Indices of the grouped peaks in detList
+*
+*  @retval Number of grouped peaks
+*
+*/
+uint32_t Test_peakGroupingRef(DPU_AoAProcHWA_CfarDetOutput * detList,
+                              uint32_t numDetectedObjects,
+                              uint32_t maxGroupedObjs,
+                              uint16_t numAngleBins,
+                              float thresholdScal,
+                              uint16_t * outIdxList)
+{
+#define KERNEL_SIZE 5
+#define KERNEL_MIDDLE ((KERNEL_SIZE-1)/2)
+
+    int32_t i, j, listIdx;
+    uint32_t numObjOut = 0;
+    int32_t cCol, cRow;
+    uint16_t discardListCnt;
+    int32_t mask = numAngleBins -1;
+    uint16_t detectedObjFlag;
+    uint32_t kernel[KERNEL_SIZE * KERNEL_SIZE];
+    uint16_t discardList[KERNEL_SIZE * KERNEL_SIZE];
+    int32_t tCol, tRow, kCol, kRow, mCol, mRow;
+    uint32_t threshold;
+    uint32_t peakMax;
+    int32_t numHalfAngleBins = (numAngleBins >> 1);
+
+    /* Find the highest peak and set a threshold */
+    peakMax = 0;
+    for (i = 0; i < numDetectedObjects; i++)
+    {
+        if (detList[i].peak > peakMax)
+        {
+            peakMax = detList[i].peak;
+        }
+    }
+    threshold = (uint32_t) (thresholdScal * (float) peakMax);
+
+    for (i = 0; i < numDetectedObjects; i++)
+    {
+        if (detList[i].peak < threshold)
+        {
+            continue;
+        }
+        /* pull the point from the list, cell under test (CUT) */
+        cCol = detList[i].cellIdx;
+        cRow = detList[i].iterNum;
+        detectedObjFlag = 1;
+        discardListCnt = 0;
+
+        /* Fill the kernel with CUT, current row to the left of CUT, and the rows above the center row */
+        for (j = 0; j < numDetectedObjects; j++)
+        {
+            listIdx = i - j;
+            if (listIdx < 0)
+            {
+                listIdx = listIdx + numDetectedObjects;
+            }
+
+            mCol = (int32_t) detList[listIdx].cellIdx;
+            mRow = (int32_t) detList[listIdx].iterNum;
+
+            tCol = (mCol - cCol) & mask;
+            tRow = (mRow - cRow) & mask;
+            if (tCol >= numHalfAngleBins)
+            {
+                tCol -= (int32_t) numAngleBins;
+            }
+            if (tRow >= numHalfAngleBins)
+            {
+                tRow -= (int32_t) numAngleBins;
+            }
+
+            kCol = tCol + KERNEL_MIDDLE;
+            kRow = tRow + KERNEL_MIDDLE;
+
+            if (kRow < 0)
+            {
+                /* Stop search above this row */
+                break;
+            }
+
+            if ((kCol >= 0) && (kCol < KERNEL_SIZE) && (kRow < KERNEL_SIZE)&& (discardListCnt < (KERNEL_SIZE*KERNEL_SIZE)))
+            {
+                kernel[discardListCnt] = detList[listIdx].peak;
+                discardList[discardListCnt++] = listIdx;
+            }
+        }
+
+        /* Fill the kernel current row to the right of CUT and rows below the center row */
+        for (j = 1; j < numDetectedObjects; j++)
+        {
+            listIdx = i + j;
+            if (listIdx >= numDetectedObjects)
+            {
+                listIdx = listIdx - (int32_t) numDetectedObjects;
+            }
+
+            mCol = (int32_t) detList[listIdx].cellIdx;
+            mRow = (int32_t) detList[listIdx].iterNum;
+
+            tCol = (mCol - cCol) & mask;
+            tRow = (mRow - cRow) & mask;
+            if (tCol >= numHalfAngleBins)
+            {
+                tCol -= (int32_t) numAngleBins;
+            }
+            if (tRow >= numHalfAngleBins)
+            {
+                tRow -= (int32_t) numAngleBins;
+            }
+
+            kCol = tCol + KERNEL_MIDDLE;
+            kRow = tRow + KERNEL_MIDDLE;
+
+            if (kRow > (KERNEL_SIZE -1))
+            {
+                /* Stop search below this row */
+                break;
+            }
+
+            if ((kCol >= 0) && (kCol < KERNEL_SIZE) && (kRow >= 0) && (discardListCnt < (KERNEL_SIZE*KERNEL_SIZE)))
+            {
+                kernel[discardListCnt] = detList[listIdx].peak;
+                discardList[discardListCnt++] = listIdx;
+            }
+        }
+
+        /* Compare the CUT (in kernel[0]) to its neighbors. */
+        for (j = 1; j < discardListCnt; j++)
+        {
+            if (kernel[j] > kernel[0])
+            {
+                detectedObjFlag = 0;
+                break;
+            }
+        }
+
+        if (detectedObjFlag == 1)
+        {
+            /* CUT is local peak, put its index in the output index list */
+            outIdxList[numObjOut++] = i;
+            for (j = 0; j < discardListCnt; j++)
+            {
+                /* mark all peaks from kernel as used (reserved) */
+                detList[discardList[j]].reserved = 1;
+            }
+        }
+
+        if (numObjOut >= maxGroupedObjs)
+        {
+            break;
+        }
+    }
+
+    return numObjOut;
+}
+
+/**
+*  @b Description
+*  @n
+*     Generates a random HWA CFAR detection list in the HWA CFAR output order:
+*     ascending iteration number, and ascending cell index within an iteration.
+*     Every iteration holds from zero up to the given number of peaks at distinct
+*     cells. Small peak values are used in every other list to produce equal
+*     neighboring peaks.
+*
+*  @param[out]     detList          Generated list
+*  @param[in]      numPeaksPerIter  Maximum number of peaks per iteration
+*  @param[in]      runIdx           Run index
+*
+*  @retval Number of peaks in the list
+*
+*/
+uint32_t Test_cfarListGen(DPU_AoAProcHWA_CfarDetOutput * detList,
+                          uint32_t numPeaksPerIter,
+                          uint32_t runIdx)
+{
+    uint32_t iterNum, cellIdx, numPeaks, k;
+    uint32_t numPeaksInIter;
+    uint8_t  cellUsed[DPU_AOAPROCHWA_NUM_ANGLE_BINS];
+    uint32_t peakRange = (runIdx & 0x1) ? 16U : 0x10000U;
+
+    numPeaks = 0;
+    for (iterNum = 0; iterNum < DPU_AOAPROCHWA_NUM_ANGLE_BINS; iterNum++)
+    {
+        memset((void *) cellUsed, 0, sizeof(cellUsed));
+        numPeaksInIter = (uint32_t) rand() % (numPeaksPerIter + 1);
+        for (k = 0; k < numPeaksInIter; k++)
+        {
+            cellUsed[(uint32_t) rand() % DPU_AOAPROCHWA_NUM_ANGLE_BINS] = 1;
+        }
+        for (cellIdx = 0; cellIdx < DPU_AOAPROCHWA_NUM_ANGLE_BINS; cellIdx++)
+        {
+            if (cellUsed[cellIdx])
+            {
+                detList[numPeaks].peak = 1U + (uint32_t) rand() % peakRange;
+                detList[numPeaks].cellIdx = cellIdx;
+                detList[numPeaks].iterNum = iterNum;
+                detList[numPeaks].reserved = 0;
+                numPeaks++;
+            }
+        }
+    }
+    return numPeaks;
+}
+
+/**
+*  @b Description
+*  @n
+*     Compares the outputs of the reference and the tested peak grouping.
+*
+*  @retval 1 if the outputs are identical, 0 otherwise
+*
+*/
+uint32_t Test_compareResults(uint32_t numPeaks, uint32_t numRefOut, uint32_t numDutOut)
+{
+    uint32_t i;
+
+    if (numRefOut != numDutOut)
+    {
+        System_printf("Number of grouped peaks: ref=%d, out=%d\n", numRefOut, numDutOut);
+        return 0;
+    }
+    for (i = 0; i < numRefOut; i++)
+    {
+        if (testRefIdxList[i] != testDutIdxList[i])
+        {
+            System_printf("Grouped peak %d: ref=%d, out=%d\n", i, testRefIdxList[i], testDutIdxList[i]);
+            return 0;
+        }
+    }
+    for (i = 0; i < numPeaks; i++)
+    {
+        if (testRefList[i].reserved != testDutList[i].reserved)
+        {
+            System_printf("Reserved flag of peak %d: ref=%d, out=%d\n", i, testRefList[i].reserved, testDutList[i].reserved);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+*  @b Description
+*  @n
+*     Test task. Runs the peak grouping tests for all densities, threshold scales
+*     and output list limits, and prints the average cycles per call.
+*
+*  @retval None
+*
+*/
+void Test_task(UArg arg0, UArg arg1)
+{
+    uint32_t densityIdx, thresholdIdx, limitIdx, runIdx;
+    uint32_t numPeaks, numRefOut, numDutOut, maxGroupedObjs;
+    uint32_t startTime, refCycles, dutCycles, totalPeaks;
+    uint32_t configResult;
+
+    finalResults = 1;
+    srand(1);
+
+    for (densityIdx = 0; densityIdx < TEST_NUM_DENSITIES; densityIdx++)
+    {
+        for (thresholdIdx = 0; thresholdIdx < TEST_NUM_THRESHOLDS; thresholdIdx++)
+        {
+            for (limitIdx = 0; limitIdx < 2; limitIdx++)
+            {
+                /* DPU output limit, and no limit to compare the complete grouping */
+                maxGroupedObjs = (limitIdx == 0) ? DPU_AOAPROCHWA_MAX_NUM_GROUPED_TARGETS_PER_RANGE_DOPPLER_PT :
+                                                   DPU_AOAPROCHWA_MAX_NUM_CFAR_DET_PEAKS;
+                refCycles = 0;
+                dutCycles = 0;
+                totalPeaks = 0;
+                configResult = 1;
+
+                for (runIdx = 0; runIdx < TEST_NUM_RUNS; runIdx++)
+                {
+                    numPeaks = Test_cfarListGen(testCfarList, testNumPeaksPerIter[densityIdx], runIdx);
+                    totalPeaks += numPeaks;
+
+                    memcpy((void *) testRefList, (void *) testCfarList, numPeaks * sizeof(DPU_AoAProcHWA_CfarDetOutput));
+                    memcpy((void *) testDutList, (void *) testCfarList, numPeaks * sizeof(DPU_AoAProcHWA_CfarDetOutput));
+
+                    startTime = Cycleprofiler_getTimeStamp();
+                    numRefOut = Test_peakGroupingRef(testRefList,
+                                                     numPeaks,
+                                                     maxGroupedObjs,
+                                                     DPU_AOAPROCHWA_NUM_ANGLE_BINS,
+                                                     testThresholdScal[thresholdIdx],
+                                                     testRefIdxList);
+                    refCycles += Cycleprofiler_getTimeStamp() - startTime;
+
+                    startTime = Cycleprofiler_getTimeStamp();
+                    numDutOut = AoAProcHWA_peakGrouping(testDutList,
+                                                        numPeaks,
+                                                        maxGroupedObjs,
+                                                        DPU_AOAPROCHWA_NUM_ANGLE_BINS,
+                                                        testThresholdScal[thresholdIdx],
+                                                        testDutIdxList);
+                    dutCycles += Cycleprofiler_getTimeStamp() - startTime;
+
+                    if (Test_compareResults(numPeaks, numRefOut, numDutOut) == 0)
+                    {
+                        configResult = 0;
+                    }
+                }
+
+                System_printf("Peaks/iteration<=%d, threshold=%.1f, max out=%d, avg peaks=%d: cycles ref=%d, out=%d %s\n",
+                              testNumPeaksPerIter[densityIdx],
+                              testThresholdScal[thresholdIdx],
+                              maxGroupedObjs,
+                              totalPeaks / TEST_NUM_RUNS,
+                              refCycles / TEST_NUM_RUNS,
+                              dutCycles / TEST_NUM_RUNS,
+                              configResult ? "PASS" : "FAIL");
+                if (configResult == 0)
+                {
+                    finalResults = 0;
+                }
+            }
+        }
+    }
+
+    System_printf("----------------------------------------\n\n");
+    if (finalResults == 1)
+    {
+        System_printf("All Tests PASSED!\n");
+        MCPI_setFeatureTestResult("AOA2D_PEAK_GROUPING", MCPI_TestResult_PASS);
+    }
+    else
+    {
+        System_printf("Test FAILED!\n");
+        MCPI_setFeatureTestResult("AOA2D_PEAK_GROUPING", MCPI_TestResult_FAIL);
+    }
+
+    System_printf("Test Finished\n");
+
+    MCPI_setTestResult();
+
+    /* Exit BIOS */
+    BIOS_exit(0);
+}
+
+/**
+*  @b Description
+*  @n
+*     test main function
+*
+*  @retval None
+*
+*/
+int main (void)
+{
+    Task_Params taskParams;
+    int32_t     errCode;
+    SOC_Cfg     socCfg;
+
+    /* Initialize test logger */
+    MCPI_Initialize();
+
+    /* Initialize the ESM: Dont clear errors as TI RTOS does it */
+    ESM_init(0U);
+
+    Cycleprofiler_init();
+
+    /* Initialize the SOC confiugration: */
+    memset ((void *)&socCfg, 0, sizeof(SOC_Cfg));
+
+    /* Populate the SOC configuration: */
+    socCfg.clockCfg = SOC_SysClock_INIT;
+
+    /* Initialize the SOC Module: This is done as soon as the application is started
+     * to ensure that the MPU is correctly configured. */
+    socHandle = SOC_init (&socCfg, &errCode);
+    if (socHandle == NULL)
+    {
+        printf ("Error: SOC Module Initialization failed [Error code %d]\n", errCode);
+        DebugP_assert(0);
+        return -1;
+    }
+
+    /* Initialize the Task Parameters. */
+    Task_Params_init(&taskParams);
+    taskParams.stackSize = 4*1024;
+    Task_create(Test_task, &taskParams, NULL);
+
+    /* Start BIOS */
+    BIOS_start();
+
+    return 0;
+}
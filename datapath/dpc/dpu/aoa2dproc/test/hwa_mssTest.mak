@@ -0,0 +1,80 @@
+###################################################################################
+# aoa2d PROC Test
+###################################################################################
+.PHONY: aoa2dHwaMssTest aoa2dHwaMssTestClean
+
+###################################################################################
+# Setup the VPATH:
+###################################################################################
+vpath %.c $(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpc/dpu/aoa2dproc/test
+vpath %.c $(MMWAVE_SDK_INSTALL_PATH)/ti/utils/mathutils/src
+
+###################################################################################
+# The AOA2D PROC Test requires additional libraries
+###################################################################################
+HWAAOA2DPROC_TEST_STD_LIBS = $(R4F_COMMON_STD_LIB)								\
+           				-llibedma_$(MMWAVE_SDK_DEVICE_TYPE).$(R4F_LIB_EXT) 		\
+           				-llibhwa_$(MMWAVE_SDK_DEVICE_TYPE).$(R4F_LIB_EXT)       \
+                        -llibtestlogger_$(MMWAVE_SDK_DEVICE_TYPE).$(R4F_LIB_EXT) \
+						-llibaoa2dproc_hwa_$(MMWAVE_SDK_DEVICE_TYPE).$(R4F_LIB_EXT) \
+						-llibdpedma_hwa_$(MMWAVE_SDK_DEVICE_TYPE).$(R4F_LIB_EXT)
+HWAAOA2DPROC_TEST_LOC_LIBS = $(R4F_COMMON_LOC_LIB)								\
+						-i$(MMWAVE_SDK_INSTALL_PATH)/ti/drivers/edma/lib 	\
+           				-i$(MMWAVE_SDK_INSTALL_PATH)/ti/drivers/hwa/lib    \
+                        -i$(MMWAVE_SDK_INSTALL_PATH)/ti/utils/testlogger/lib \
+						-i$(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpc/dpu/aoa2dproc/lib \
+						-i$(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpedma/lib
+
+
+###################################################################################
+# Unit Test Files
+###################################################################################
+HWAAOA2DPROC_TEST_CFG	 	 = test/mss.cfg
+HWAAOA2DPROC_TEST_CMD       = $(MMWAVE_SDK_INSTALL_PATH)/ti/platform/$(MMWAVE_SDK_DEVICE_TYPE)
+HWAAOA2DPROC_TEST_CONFIGPKG = test/mss_configPkg_$(MMWAVE_SDK_DEVICE_TYPE)
+HWAAOA2DPROC_TEST_MAP       = test/$(MMWAVE_SDK_DEVICE_TYPE)_aoa2dprochwa_mss.map
+HWAAOA2DPROC_TEST_OUT       = test/$(MMWAVE_SDK_DEVICE_TYPE)_aoa2dprochwa_mss.$(R4F_EXE_EXT)
+HWAAOA2DPROC_TEST_BIN       = test/$(MMWAVE_SDK_DEVICE_TYPE)_aoa2dprochwa_mss.bin
+HWAAOA2DPROC_TEST_APP_CMD   = test/mss_aoa2dproc_linker.cmd
+HWAAOA2DPROC_TEST_SOURCES   = aoa2dprochwa_test_main.c \
+								 mathutils.c
+
+HWAAOA2DPROC_TEST_DEPENDS 	 = $(addprefix $(PLATFORM_OBJDIR)/, $(HWAAOA2DPROC_TEST_SOURCES:.c=.$(R4F_DEP_EXT)))
+HWAAOA2DPROC_TEST_OBJECTS 	 = $(addprefix $(PLATFORM_OBJDIR)/, $(HWAAOA2DPROC_TEST_SOURCES:.c=.$(R4F_OBJ_EXT)))
+
+###################################################################################
+# RTSC Configuration:
+###################################################################################
+aoa2dhwaMssRTSC: $(R4_CFG)
+	@echo 'Configuring RTSC packages...'
+	$(XS) --xdcpath="$(XDCPATH)" xdc.tools.configuro $(R4F_XSFLAGS) -o $(HWAAOA2DPROC_TEST_CONFIGPKG) $(HWAAOA2DPROC_TEST_CFG)
+	@echo 'Finished configuring packages'
+	@echo ' '
+
+###################################################################################
+# Build Unit Test:
+###################################################################################
+aoa2dHwaMssTest: BUILD_CONFIGPKG=$(HWAAOA2DPROC_TEST_CONFIGPKG)
+aoa2dHwaMssTest: R4F_CFLAGS += --cmd_file=$(BUILD_CONFIGPKG)/compiler.opt
+aoa2dHwaMssTest: buildDirectories aoa2dhwaMssRTSC $(HWAAOA2DPROC_TEST_OBJECTS)
+	$(R4F_LD) $(R4F_LDFLAGS) $(HWAAOA2DPROC_TEST_LOC_LIBS) $(HWAAOA2DPROC_TEST_STD_LIBS) -l$(HWAAOA2DPROC_TEST_CONFIGPKG)/linker.cmd --map_file=$(HWAAOA2DPROC_TEST_MAP) $(HWAAOA2DPROC_TEST_OBJECTS) \
+	$(PLATFORM_R4F_LINK_CMD) $(HWAAOA2DPROC_TEST_APP_CMD) $(R4F_LD_RTS_FLAGS) -o $(HWAAOA2DPROC_TEST_OUT)
+	@echo '******************************************************************************'
+	@echo 'Built the aoa2d proc R4 Unit Test '
+	@echo '******************************************************************************'
+
+###################################################################################
+# Cleanup Unit Test:
+###################################################################################
+aoa2dHwaMssTestClean:
+	@echo 'Cleaning the AOA2D PROC R4 Unit Test objects'
+	@$(DEL) $(HWAAOA2DPROC_TEST_OBJECTS) $(HWAAOA2DPROC_TEST_OUT) $(HWAAOA2DPROC_TEST_BIN)
+	@$(DEL) $(HWAAOA2DPROC_TEST_MAP) $(HWAAOA2DPROC_TEST_DEPENDS)
+	@echo 'Cleaning the AOA2D PROC R4 Unit RTSC package'
+	@$(DEL) $(HWAAOA2DPROC_TEST_CONFIGPKG)
+	@$(DEL) $(PLATFORM_OBJDIR)
+
+###################################################################################
+# Dependency handling
+###################################################################################
+-include $(HWAAOA2DPROC_TEST_DEPENDS)
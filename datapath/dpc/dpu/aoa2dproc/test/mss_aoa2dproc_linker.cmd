@@ -0,0 +1,13 @@
+/*----------------------------------------------------------------------------*/
+/* Linker Settings                                                            */
+--retain="*(.intvecs)"
+
+/*----------------------------------------------------------------------------*/
+/* Section Configuration                                                      */
+SECTIONS
+{
+    systemHeap : {} > DATA_RAM
+    .MCPILogBuffer  : { } > DATA_RAM | L3_RAM
+}
+/*----------------------------------------------------------------------------*/
+
@@ -325,6 +325,18 @@
  *
  *      @image html dsp_aoa_BPM.png "BPM Scheme Antenna configuration"
  *
+ *  @subsection aoa_dspInstances Processing the detection list with several DPU instances
+ *    All the processing state of AoAProcDSP is held in the instance object created by
+ *    @ref DPU_AoAProcDSP_init and in the buffers passed in @ref DPU_AoAProcDSP_HW_Resources,
+ *    the DPU has no global state. Independent instances, each configured with its own
+ *    scratch buffers (sized per the same rules, e.g. @ref DPU_AoAProcDSP_HW_Resources::scratch1Buff),
+ *    its own part of the CFAR detection list and its own output lists, can therefore
+ *    process parts of one frame's detection list concurrently. Concatenating the output
+ *    lists in the order of the detection list parts gives the same point cloud,
+ *    including the multi-object beamforming points, as a single instance that processes
+ *    the whole list one detection at a time. Range bin grouped processing orders its
+ *    output by range bin within each part.
+ *
  *
  * @section api_sectionDSP AoAProcDSP APIs
  *
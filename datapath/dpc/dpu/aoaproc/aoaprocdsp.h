@@ -344,6 +344,31 @@ typedef struct DPU_AoAProcDSP_Resources_t
 
     /*! @brief      Size of the scratch2 buffer */
     uint32_t        scratch2Size;
+
+    /*! @brief      Scratch buffer for the CFAR list indices sorted by range bin.
+                    Together with @ref dopplerFftRowBuf it enables range bin grouped processing,
+                    where each radar cube row is fetched once for all objects on that range bin
+                    with the same output list as processing the objects one by one in CFAR list order.
+                    If either buffer is NULL, or if the multi peak search could produce more points
+                    than @ref detObjOutMaxSize, objects are processed one by one.\n
+                    Size: sizeof(uint16_t) * @ref detObjOutMaxSize \n
+                    Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
+     */
+    uint16_t        *rangeGroupIdxBuf;
+
+    /*! @brief      Size of the range group index buffer */
+    uint32_t        rangeGroupIdxSize;
+
+    /*! @brief      Scratch buffer for the Doppler FFT output of all virtual antennas
+                    of the range bin being processed, see @ref rangeGroupIdxBuf.\n
+                    Size: sizeof(cmplx32ReIm_t) * numTxAntennas * numRxAntennas * numDopplerBins \n
+                    Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
+     */
+    cmplx32ReIm_t   *dopplerFftRowBuf;
+
+    /*! @brief      Size of the Doppler FFT row buffer */
+    uint32_t        dopplerFftRowSize;
+
 } DPU_AoAProcDSP_HW_Resources;
 
 /**
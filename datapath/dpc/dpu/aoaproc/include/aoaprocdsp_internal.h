@@ -69,6 +69,10 @@ extern "C" {
 /*! Pong index used for EDMA-CPU processing parallelism */
 #define DPU_AOAPROCDSP_PONG_IDX 1
 
+/*! Azimuth index marking an unused output slot in range bin grouped processing,
+ *  never a valid index as it is not below @ref DPU_AOAPROCDSP_NUM_ANGLE_BINS */
+#define DPU_AOAPROCDSP_EMPTY_OUT_SLOT 0xFFU
+
 /**
  * @brief
  *  Field of view - AoA Configuration
@@ -92,6 +96,10 @@ typedef struct DPU_AoAProc_fovAoaLocalCfg_t
 
     /*! @brief    maximum elevation angle (expressed as sine value) */
     float        maxElevationSineVal;
+
+    /*! @brief    Azimuth angle bin mask, zero for the bins that can not pass the
+     *            azimuth field of view check for any elevation */
+    uint8_t      azimuthBinMask[DPU_AOAPROCDSP_NUM_ANGLE_BINS];
 } DPU_AoAProc_fovAoaLocalCfg;
 
 
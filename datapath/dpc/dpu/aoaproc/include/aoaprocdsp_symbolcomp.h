@@ -0,0 +1,70 @@
+/**
+ *   @file  aoaprocdsp_symbolcomp.h
+ *
+ *   @brief
+ *      Internal header for the virtual antenna symbol compensation shared by the
+ *      DSP AoA DPUs (aoaproc and aoaprocdcmp).
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AOAPROCDSP_SYMBOLCOMP_H
+#define AOAPROCDSP_SYMBOLCOMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* mmWave SDK Include Files */
+#include <ti/common/sys_common.h>
+
+void AoAProcDSP_symbolCompensation
+(
+    cmplx32ReIm_t *symbols,
+    cmplx16ImRe_t *rxChComp,
+    int32_t  dopplerSignIdx,
+    uint32_t numTxAnt,
+    uint32_t numRxAnt,
+    uint32_t numVirtualAnt,
+    uint32_t numDopplerBins,
+    bool     isBpmEnabled
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -84,6 +84,10 @@ typedef struct DPU_AoAProc_fovAoaLocalCfg_t
 
     /*! @brief    maximum elevation angle (expressed as sine value) */
     float        maxElevationSineVal;
+
+    /*! @brief    Azimuth angle bin mask, zero for the bins that can not pass the
+     *            azimuth field of view check for any elevation */
+    uint8_t      azimuthBinMask[DPU_AOAPROCHWA_NUM_ANGLE_BINS];
 } DPU_AoAProc_fovAoaLocalCfg;
 
 
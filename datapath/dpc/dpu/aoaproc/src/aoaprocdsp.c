@@ -59,6 +59,7 @@
 /* Data Path Include Files */
 #include <ti/datapath/dpedma/dpedma.h>
 #include <ti/datapath/dpc/dpu/aoaproc/include/aoaprocdsp_internal.h>
+#include <ti/datapath/dpc/dpu/aoaproc/include/aoaprocdsp_symbolcomp.h>
 #include <ti/utils/cycleprofiler/cycle_profiler.h>
 #include <ti/utils/mathutils/mathutils.h>
 
@@ -621,11 +622,14 @@ static inline uint32_t AoAProcDSP_angleEstimationAzimElev
                                         &maxVal);
 
     /* Estimate x,y,z */
-    objOutIdx = AoAProcDSP_XYZestimation(aoaDspObj,
-                                         objOutIdx,
-                                         objInCfarIdx,
-                                         maxIdx,
-                                         dopplerSignIdx);
+    if (aoaDspObj->dynLocalCfg.fovAoaLocalCfg.azimuthBinMask[maxIdx])
+    {
+        objOutIdx = AoAProcDSP_XYZestimation(aoaDspObj,
+                                             objOutIdx,
+                                             objInCfarIdx,
+                                             maxIdx,
+                                             dopplerSignIdx);
+    }
                                          
     if (objOutIdx >= maxNumObj)
     {
@@ -646,7 +650,8 @@ static inline uint32_t AoAProcDSP_angleEstimationAzimElev
         maxVal2 = azimuthMag[azimIdx];
                 
         /* Is second peak greater than threshold? */
-        if ( (maxVal2 >( ((maxVal * aoaDspObj->dynLocalCfg.multiObjBeamFormingCfg.multiPeakThrsScal)))) && (objOutIdx < maxNumObj) )
+        if ( (maxVal2 >( ((maxVal * aoaDspObj->dynLocalCfg.multiObjBeamFormingCfg.multiPeakThrsScal)))) && (objOutIdx < maxNumObj) &&
+             aoaDspObj->dynLocalCfg.fovAoaLocalCfg.azimuthBinMask[azimIdx])
         {
 
             /* Estimate x,y,z for second peak */
@@ -965,7 +970,9 @@ exit:
  *  @b Description
  *  @n
  *      The function converts angle of arrival field of view values specified
- *      in degrees to the values appropriate for internal DPU comparison.
+ *      in degrees to the values appropriate for internal DPU comparison. It also
+ *      builds the azimuth angle bin mask, so that the peaks outside of the field
+ *      of view are rejected before the x/y/z estimation.
  *
  *  @param[in]  aoaDspObj    Pointer to internal AoAProc data object
  *
@@ -979,10 +986,48 @@ exit:
 static void AoAProcDSP_ConvertFov(AOADspObj *aoaDspObj,
                                   DPU_AoAProc_FovAoaCfg *fovAoaCfg)
 {
+    DPU_AoAProc_fovAoaLocalCfg *fovAoaLocalCfg = &aoaDspObj->dynLocalCfg.fovAoaLocalCfg;
+    float lambdaOverDist = aoaDspObj->params.lambdaOverDist;
+    float minSineVal, maxSineVal, sineVal, Wx;
+    int32_t sBinIdx;
+    uint32_t binIdx;
+
     aoaDspObj->dynLocalCfg.fovAoaLocalCfg.minAzimuthSineVal = sin(fovAoaCfg->minAzimuthDeg / 180. * PI_);
     aoaDspObj->dynLocalCfg.fovAoaLocalCfg.maxAzimuthSineVal = sin(fovAoaCfg->maxAzimuthDeg / 180. * PI_);
     aoaDspObj->dynLocalCfg.fovAoaLocalCfg.minElevationSineVal = sin(fovAoaCfg->minElevationDeg / 180. * PI_);
     aoaDspObj->dynLocalCfg.fovAoaLocalCfg.maxElevationSineVal = sin(fovAoaCfg->maxElevationDeg  / 180. * PI_);
+
+    /* Azimuth bin mask. The azimuth limits are scaled in the field of view check
+       by the elevation term (limitScale <= 1), so with elevation antennas a bin can
+       pass it only if its sine value is within [min(minAzimuthSine, 0), max(maxAzimuthSine, 0)].
+       The sine value is computed the same way as in the field of view check. */
+    minSineVal = fovAoaLocalCfg->minAzimuthSineVal;
+    maxSineVal = fovAoaLocalCfg->maxAzimuthSineVal;
+    if (aoaDspObj->params.numVirtualAntElev > 0)
+    {
+        if (minSineVal > 0)
+        {
+            minSineVal = 0;
+        }
+        if (maxSineVal < 0)
+        {
+            maxSineVal = 0;
+        }
+    }
+    for (binIdx = 0; binIdx < DPU_AOAPROCDSP_NUM_ANGLE_BINS; binIdx++)
+    {
+        if (binIdx > (DPU_AOAPROCDSP_NUM_ANGLE_BINS/2 -1))
+        {
+            sBinIdx = (int32_t) binIdx - (int32_t) DPU_AOAPROCDSP_NUM_ANGLE_BINS;
+        }
+        else
+        {
+            sBinIdx = (int32_t) binIdx;
+        }
+        Wx = 2 * (float) sBinIdx / DPU_AOAPROCDSP_NUM_ANGLE_BINS;
+        sineVal = (lambdaOverDist/2)*Wx;
+        fovAoaLocalCfg->azimuthBinMask[binIdx] = (uint8_t) ((sineVal >= minSineVal) && (sineVal <= maxSineVal));
+    }
 }
 
 /**
@@ -1014,47 +1059,118 @@ static inline void AoAProcDSP_generateTables
 /**
  *  @b Description
  *  @n
- *    Decodes BPM 
+ *    Orders the CFAR list by range bin so that detections sharing a radar cube
+ *    row are processed back to back. The CFAR list itself is not modified, the
+ *    order is written as CFAR list indices to @ref DPU_AoAProcDSP_HW_Resources::rangeGroupIdxBuf.
+ *    Detections on the same range bin keep their CFAR list order.
  *
- * @param[inout]  virtAntennaBuf : Pointer to antenna symbols 
- *            
- * @param[in]  numRxAnt  : Number of RX antennas
- 
- *  @retval
- *      Not Applicable.
+ *  @param[in]    aoaDspObj   DPU object
+ *  @param[in]    numObjsIn   Number of objects in CFAR list
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval     None
  */
-static inline void AoAProcDSP_decodeBPM(cmplx32ReIm_t *virtAntennaBuf, uint16_t numRxAnt)
+static void AoAProcDSP_sortByRangeIdx
+(
+    AOADspObj                 *aoaDspObj,
+    uint32_t                  numObjsIn
+)
 {
-    cmplx32ReIm_t *bpmAPtr;
-    cmplx32ReIm_t *bpmBPtr;
-    int32_t real, imag, idx;
+    DPIF_CFARDetList *objIn = aoaDspObj->res.cfarRngDopSnrList;
+    uint16_t *order = aoaDspObj->res.rangeGroupIdxBuf;
+    uint32_t idx, gap, j;
+    uint16_t cfarIdx;
+    uint32_t key;
 
-    bpmAPtr  = &virtAntennaBuf[0];
-    bpmBPtr  = &virtAntennaBuf[numRxAnt];
-    
-    for(idx = 0; idx < numRxAnt; idx++)
-    {        
-        /*BPM decoding*/                        
-        /*store A*/
-        real = bpmAPtr[idx].real;
-        imag = bpmAPtr[idx].imag;
-        /*compute S1 and store in place*/
-        bpmAPtr[idx].real = (bpmAPtr[idx].real + bpmBPtr[idx].real)/2;
-        bpmAPtr[idx].imag = (bpmAPtr[idx].imag + bpmBPtr[idx].imag)/2;
-        /*compute S2 and store in place*/
-        bpmBPtr[idx].real = (real - bpmBPtr[idx].real)/2;
-        bpmBPtr[idx].imag = (imag - bpmBPtr[idx].imag)/2;
+    for (idx = 0; idx < numObjsIn; idx++)
+    {
+        order[idx] = (uint16_t) idx;
+    }
+
+    /* Shell sort on (rangeIdx, cfar index), the second term keeps equal range bins in list order */
+    for (gap = numObjsIn >> 1; gap > 0; gap >>= 1)
+    {
+        for (idx = gap; idx < numObjsIn; idx++)
+        {
+            cfarIdx = order[idx];
+            key = ((uint32_t) objIn[cfarIdx].rangeIdx << 16) | cfarIdx;
+            for (j = idx; j >= gap; j -= gap)
+            {
+                if ((((uint32_t) objIn[order[j - gap]].rangeIdx << 16) | order[j - gap]) <= key)
+                {
+                    break;
+                }
+                order[j] = order[j - gap];
+            }
+            order[j] = cfarIdx;
+        }
     }
 }
 
 /**
  *  @b Description
  *  @n
- *    AoA processing when there are more than one virtual antennas 
+ *    Range bin grouped processing writes the points of CFAR object i to the output
+ *    slots [i * slotsPerObj, (i + 1) * slotsPerObj), slots left empty keep
+ *    @ref DPU_AOAPROCDSP_EMPTY_OUT_SLOT in @ref DPU_AoAProcDSP_HW_Resources::detObj2dAzimIdx.
+ *    This function moves the filled slots to the start of the output lists, which gives
+ *    the same list as processing the objects in CFAR list order.
  *
  *  @param[in]    aoaDspObj   DPU object
- *  @param[in]    numObjsIn   Number of objects in CFAR list
- *  @param[out]   numObjsOut  Number of detected objects in the output list
+ *  @param[in]    numSlots    Number of output slots used
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval     Number of detected objects in the output list
+ */
+static uint32_t AoAProcDSP_compactOutputSlots
+(
+    AOADspObj                 *aoaDspObj,
+    uint32_t                  numSlots
+)
+{
+    DPU_AoAProcDSP_HW_Resources *res = &aoaDspObj->res;
+    uint32_t slotIdx;
+    uint32_t objOutIdx = 0;
+
+    for (slotIdx = 0; slotIdx < numSlots; slotIdx++)
+    {
+        if (res->detObj2dAzimIdx[slotIdx] == DPU_AOAPROCDSP_EMPTY_OUT_SLOT)
+        {
+            continue;
+        }
+
+        if (objOutIdx != slotIdx)
+        {
+            res->detObjOut[objOutIdx]         = res->detObjOut[slotIdx];
+            res->detObjOutSideInfo[objOutIdx] = res->detObjOutSideInfo[slotIdx];
+            res->detObj2dAzimIdx[objOutIdx]   = res->detObj2dAzimIdx[slotIdx];
+            if (aoaDspObj->params.numVirtualAntElev > 0)
+            {
+                res->detObjElevationAngle[objOutIdx] = res->detObjElevationAngle[slotIdx];
+            }
+        }
+        objOutIdx++;
+    }
+
+    return objOutIdx;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Fetches all virtual antennas of one range bin from the radar cube using the
+ *    EDMA ping/pong scheme and computes their Doppler FFT.\n
+ *    If dopplerRow is NULL, only the bin dopplerIdx of each virtual antenna is kept
+ *    and it is saved to @ref DPU_AoAProcDSP_HW_Resources::angleFftIn.
+ *    Otherwise the full Doppler spectrum of virtual antenna (txAntIdx * numRxAntennas + rxAntIdx)
+ *    is saved at dopplerRow[(txAntIdx * numRxAntennas + rxAntIdx) * numDopplerBins].
+ *
+ *  @param[in]    aoaDspObj   DPU object
+ *  @param[in]    rangeIdx    Range bin (radar cube row) to be processed
+ *  @param[in]    dopplerIdx  Doppler bin to be saved, used only when dopplerRow is NULL
+ *  @param[out]   dopplerRow  Doppler spectra of all virtual antennas or NULL
  *  @param[inout] waitTime    CPU waiting time
  *
  *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
@@ -1063,337 +1179,492 @@ static inline void AoAProcDSP_decodeBPM(cmplx32ReIm_t *virtAntennaBuf, uint16_t
  *      Success     - 0
  *  @retval
  *      Error       - <0
- *            
  */
-static inline uint32_t AoAProcDSP_processMultipleVirtualAntennas
+static int32_t AoAProcDSP_dopplerFftRangeBin
 (
     AOADspObj                 *aoaDspObj,
-    uint32_t                  numObjsIn,
-    uint32_t                  *numObjsOut,
+    uint16_t                  rangeIdx,
+    uint16_t                  dopplerIdx,
+    cmplx32ReIm_t             *dopplerRow,
     volatile uint32_t         *waitTime
 )
 {
-    uint16_t idx, rxAntIdx, rangeIdx, txAntIdx, dopplerIdx; 
-    uint16_t nextTransferRxIdx, nextTransferRangeIdx, nextTransferTxIdx; 
+    uint16_t rxAntIdx, txAntIdx;
+    uint16_t nextTransferRxIdx, nextTransferRangeIdx, nextTransferTxIdx;
     DPU_AoAProcDSP_HW_Resources *res;
     DPU_AoAProcDSP_StaticConfig *DPParams;
     cmplx16ImRe_t *inpDoppFftBuf;
-    cmplx32ReIm_t  elevationSymbols[SYS_COMMON_NUM_RX_CHANNEL];
-    uint32_t  numObjsOutLocal = 0;
     volatile uint32_t startTimeWait;
     int32_t  retVal = 0;
     cmplx16ImRe_t  *radarCubeBase;
     uint32_t pingPongIdx, nextTransferIdx;
     uint8_t channel;
     cmplx32ReIm_t *windowingBuf;
-    cmplx32ReIm_t *azimuthFftOut;
-    cmplx32ReIm_t *twoDfftOut; 
-    /* for extMaxVelocity feature: */
-    cmplx32ReIm_t *hypothesesSymbols;
-    cmplx32ReIm_t *azimuthFftOutTemp;
-    int32_t   dopplerSignIdx;
-    int32_t   hypIdx, maxHypIdx;
-    float32_t maxPow, maxPowTemp;
-    int32_t   wrapStartInd;
-
+    cmplx32ReIm_t *twoDfftOut;
 
     res = &aoaDspObj->res;
     DPParams = &aoaDspObj->params;
     radarCubeBase = (cmplx16ImRe_t *)res->radarCube.data;
-    /* Setup overlayed buffers */
     windowingBuf  = (cmplx32ReIm_t *)res->scratch1Buff;
-    azimuthFftOut = (cmplx32ReIm_t *)res->scratch1Buff;
     twoDfftOut    = (cmplx32ReIm_t *)res->scratch2Buff;
-    /* Setup overlayed buffers for extMaxVelocity feature */
-    hypothesesSymbols = (cmplx32ReIm_t *)res->scratch2Buff;
-    azimuthFftOutTemp = res->elevationFftOut;
 
-    /* Angle estimation for each object */
-    for (idx = 0; idx < numObjsIn; idx++)
-    {               
-        rangeIdx   = res->cfarRngDopSnrList[idx].rangeIdx;
-        dopplerIdx = res->cfarRngDopSnrList[idx].dopplerIdx;
-        
-        /* Reset ping/pong index */
-        pingPongIdx = DPU_AOAPROCDSP_PING_IDX;
-        
-        /* Trigger first DMA. First transfer is for [txAntIdx=0, rxAntIdx=0, rangeIdx=(Obj range from CFAR list)].
-           Note: EDMA ping/pong scheme must support #TX antennas = 1,2,3 #RX antennas = 2,4 */
-        retVal = EDMA_setSourceAddress(res->edmaHandle,
-                              res->edmaPing.channel, 
-                              (uint32_t) &radarCubeBase[rangeIdx]);
-        if (retVal != 0)
-        {
-            goto exit;
-        }
+    /* Reset ping/pong index */
+    pingPongIdx = DPU_AOAPROCDSP_PING_IDX;
 
-        EDMA_startDmaTransfer(res->edmaHandle, res->edmaPing.channel);
+    /* Trigger first DMA. First transfer is for [txAntIdx=0, rxAntIdx=0, rangeIdx=(Obj range from CFAR list)].
+       Note: EDMA ping/pong scheme must support #TX antennas = 1,2,3 #RX antennas = 2,4 */
+    retVal = EDMA_setSourceAddress(res->edmaHandle,
+                          res->edmaPing.channel,
+                          (uint32_t) &radarCubeBase[rangeIdx]);
+    if (retVal != 0)
+    {
+        goto exit;
+    }
 
-        for (rxAntIdx = 0; rxAntIdx < DPParams->numRxAntennas; rxAntIdx++)
+    EDMA_startDmaTransfer(res->edmaHandle, res->edmaPing.channel);
+
+    for (rxAntIdx = 0; rxAntIdx < DPParams->numRxAntennas; rxAntIdx++)
+    {
+        for (txAntIdx = 0; txAntIdx < DPParams->numTxAntennas; txAntIdx++)
         {
-            for (txAntIdx = 0; txAntIdx < DPParams->numTxAntennas; txAntIdx++)
+            /* verify that previous DMA has completed */
+            startTimeWait = Cycleprofiler_getTimeStamp();
+            retVal = AoAProcDSP_waitInData (res, pingPongIdx);
+            if(retVal != 0)
             {
-                /* verify that previous DMA has completed */
-                startTimeWait = Cycleprofiler_getTimeStamp();
-                retVal = AoAProcDSP_waitInData (res, pingPongIdx);
-                if(retVal != 0)
-                {
-                    goto exit;
-                }    
+                goto exit;
+            }
 
-                *waitTime += Cycleprofiler_getTimeStamp() - startTimeWait;
-                
-                /*Find index in radar cube for next EDMA.*/ 
-                nextTransferTxIdx    = txAntIdx + 1;
-                nextTransferRxIdx    = rxAntIdx;
-                nextTransferRangeIdx = rangeIdx;
-                
-                if(nextTransferTxIdx == DPParams->numTxAntennas)
+            *waitTime += Cycleprofiler_getTimeStamp() - startTimeWait;
+
+            /*Find index in radar cube for next EDMA.*/
+            nextTransferTxIdx    = txAntIdx + 1;
+            nextTransferRxIdx    = rxAntIdx;
+            nextTransferRangeIdx = rangeIdx;
+
+            if(nextTransferTxIdx == DPParams->numTxAntennas)
+            {
+               nextTransferTxIdx = 0;
+               nextTransferRxIdx++;
+               if(nextTransferRxIdx == DPParams->numRxAntennas)
+               {
+                   nextTransferRxIdx = 0;
+                   nextTransferRangeIdx++;
+               }
+            }
+
+            nextTransferIdx = (nextTransferTxIdx * DPParams->numRxAntennas * DPParams->numDopplerChirps +
+                               nextTransferRxIdx) * DPParams->numRangeBins + nextTransferRangeIdx;
+
+            /*Last computation happens when nextTransferRangeIdx reaches (rangeIdx + 1) was we are processing
+              only one range index. Therefore, do not trigger next EDMA.*/
+            if(nextTransferRangeIdx == rangeIdx)
+            {
+                /* kick off next DMA */
+                if (pingPongIdx == DPU_AOAPROCDSP_PONG_IDX)
                 {
-                   nextTransferTxIdx = 0;
-                   nextTransferRxIdx++;
-                   if(nextTransferRxIdx == DPParams->numRxAntennas)
-                   {
-                       nextTransferRxIdx = 0;
-                       nextTransferRangeIdx++;
-                   }
+                    channel = res->edmaPing.channel;
                 }
-                
-                nextTransferIdx = (nextTransferTxIdx * DPParams->numRxAntennas * DPParams->numDopplerChirps + 
-                                   nextTransferRxIdx) * DPParams->numRangeBins + nextTransferRangeIdx;
-                
-                /*Last computation happens when nextTransferRangeIdx reaches (rangeIdx + 1) was we are processing
-                  only one range index. Therefore, do not trigger next EDMA.*/
-                if(nextTransferRangeIdx == rangeIdx)
-                {
-                    /* kick off next DMA */
-                    if (pingPongIdx == DPU_AOAPROCDSP_PONG_IDX)
-                    {
-                        channel = res->edmaPing.channel;
-                    }
-                    else
-                    {
-                        channel = res->edmaPong.channel;
-                    }
-                    
-                    retVal = EDMA_setSourceAddress(res->edmaHandle, channel,
-                                         (uint32_t) &radarCubeBase[nextTransferIdx]);
-                    if (retVal != 0)
-                    {
-                        goto exit;
-                    }
-                                         
-                    EDMA_startDmaTransfer(res->edmaHandle, channel);
-                }    
-                
-                inpDoppFftBuf = (cmplx16ImRe_t *) &res->pingPongBuf[pingPongIdx * DPParams->numDopplerChirps];
-
-                /* Remove static clutter? */
-                if (aoaDspObj->dynLocalCfg.staticClutterCfg.isEnabled)
+                else
                 {
-                    AoAProcDSP_clutterRemoval(DPParams, inpDoppFftBuf);
+                    channel = res->edmaPong.channel;
                 }
-                
-                /* The windowing output buffer is the input buffer for the Doppler FFT. 
-                   It needs to be padded with zeroes if number of Doppler chirps is less than 
-                   the number of Doppler bins.*/
-                if(DPParams->numDopplerBins > DPParams->numDopplerChirps)
+
+                retVal = EDMA_setSourceAddress(res->edmaHandle, channel,
+                                     (uint32_t) &radarCubeBase[nextTransferIdx]);
+                if (retVal != 0)
                 {
-                    memset((void*)(&windowingBuf[DPParams->numDopplerChirps]), 0,
-                           (DPParams->numDopplerBins - DPParams->numDopplerChirps) * sizeof(cmplx32ReIm_t));
+                    goto exit;
                 }
 
-                /*Up to this point samples are in ImRe format, which is the radar cube format.
-                  The windowing function will do IQ swap and the Doppler FFT is computed in
-                  ReIm format.*/                                
-                mmwavelib_windowing16x32_IQswap((int16_t *) inpDoppFftBuf,
-                                                res->windowCoeff,
-                                                (int32_t *) windowingBuf,
-                                                DPParams->numDopplerChirps); 
+                EDMA_startDmaTransfer(res->edmaHandle, channel);
+            }
 
-                /*From this point forward samples are in ReIm format. In particular, FFT, twiddle are all in ReIm format.*/                                
-        
-                /*DSPLIB notes for DSP_fft32x32():
-                  Minimum FFT size is 16. Size must be power of 2. 
-                  No scaling done in FFT computation.*/
+            inpDoppFftBuf = (cmplx16ImRe_t *) &res->pingPongBuf[pingPongIdx * DPParams->numDopplerChirps];
+
+            /* Remove static clutter? */
+            if (aoaDspObj->dynLocalCfg.staticClutterCfg.isEnabled)
+            {
+                AoAProcDSP_clutterRemoval(DPParams, inpDoppFftBuf);
+            }
+
+            /* The windowing output buffer is the input buffer for the Doppler FFT.
+               It needs to be padded with zeroes if number of Doppler chirps is less than
+               the number of Doppler bins.*/
+            if(DPParams->numDopplerBins > DPParams->numDopplerChirps)
+            {
+                memset((void*)(&windowingBuf[DPParams->numDopplerChirps]), 0,
+                       (DPParams->numDopplerBins - DPParams->numDopplerChirps) * sizeof(cmplx32ReIm_t));
+            }
+
+            /*Up to this point samples are in ImRe format, which is the radar cube format.
+              The windowing function will do IQ swap and the Doppler FFT is computed in
+              ReIm format.*/
+            mmwavelib_windowing16x32_IQswap((int16_t *) inpDoppFftBuf,
+                                            res->windowCoeff,
+                                            (int32_t *) windowingBuf,
+                                            DPParams->numDopplerChirps);
+
+            /*From this point forward samples are in ReIm format. In particular, FFT, twiddle are all in ReIm format.*/
+
+            /*DSPLIB notes for DSP_fft32x32():
+              Minimum FFT size is 16. Size must be power of 2.
+              No scaling done in FFT computation.*/
+            if (dopplerRow == NULL)
+            {
                 DSP_fft32x32((int32_t *)res->twiddle32x32,
                              DPParams->numDopplerBins,
                              (int32_t *)windowingBuf,
                              (int32_t *)twoDfftOut);
-                             
-                /* Save the 2D doppler FFT output for the required doppler bin */  
+
+                /* Save the 2D doppler FFT output for the required doppler bin */
                 res->angleFftIn[txAntIdx * DPParams->numRxAntennas + rxAntIdx] = twoDfftOut[dopplerIdx];
-                        
-                pingPongIdx ^= 1;
-            }/*txAntIdx*/
-        } /* rxAntIdx */
+            }
+            else
+            {
+                /* Keep the whole Doppler spectrum, it is shared by all objects on this range bin */
+                DSP_fft32x32((int32_t *)res->twiddle32x32,
+                             DPParams->numDopplerBins,
+                             (int32_t *)windowingBuf,
+                             (int32_t *)&dopplerRow[(txAntIdx * DPParams->numRxAntennas + rxAntIdx) *
+                                                    DPParams->numDopplerBins]);
+            }
+
+            pingPongIdx ^= 1;
+        }/*txAntIdx*/
+    } /* rxAntIdx */
+
+exit:
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Angle estimation of one object. Expects the Doppler FFT output of all virtual
+ *    antennas at the object's Doppler bin in @ref DPU_AoAProcDSP_HW_Resources::angleFftIn.
+ *    Performs Doppler compensation, BPM decoding, rx channel compensation,
+ *    azimuth/elevation FFTs and appends the detected points to the output list.
+ *
+ *  @param[in]    aoaDspObj       DPU object
+ *  @param[in]    objInCfarIdx    Index of the object in CFAR list
+ *  @param[in]    objOutIdx       Index to the next object in the output list
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval     objOutIdx         Number of detected objects in the output list
+ */
+static uint32_t AoAProcDSP_angleEstimationObj
+(
+    AOADspObj                 *aoaDspObj,
+    uint32_t                  objInCfarIdx,
+    uint32_t                  objOutIdx
+)
+{
+    DPU_AoAProcDSP_HW_Resources *res;
+    DPU_AoAProcDSP_StaticConfig *DPParams;
+    cmplx32ReIm_t  elevationSymbols[SYS_COMMON_NUM_RX_CHANNEL];
+    cmplx32ReIm_t *azimuthFftOut;
+    /* for extMaxVelocity feature: */
+    cmplx32ReIm_t *hypothesesSymbols;
+    cmplx32ReIm_t *azimuthFftOutTemp;
+    cmplx32ReIm_t *hypFftOut[2];
+    uint32_t  hypOutIdx, maxHypOutIdx;
+    int32_t   dopplerSignIdx;
+    int32_t   hypIdx, maxHypIdx;
+    float32_t maxPow, maxPowTemp;
+    int32_t   wrapStartInd;
 
-        dopplerSignIdx = AOA_DOPPLER_IDX_TO_SIGNED(dopplerIdx, DPParams->numDopplerBins);
+    res = &aoaDspObj->res;
+    DPParams = &aoaDspObj->params;
+    /* Setup overlayed buffers */
+    azimuthFftOut = (cmplx32ReIm_t *)res->scratch1Buff;
+    /* Setup overlayed buffers for extMaxVelocity feature */
+    hypothesesSymbols = (cmplx32ReIm_t *)res->scratch2Buff;
+    azimuthFftOutTemp = res->elevationFftOut;
+
+    dopplerSignIdx = AOA_DOPPLER_IDX_TO_SIGNED(res->cfarRngDopSnrList[objInCfarIdx].dopplerIdx,
+                                               DPParams->numDopplerBins);
 
-        if(!aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled || DPParams->numTxAntennas==1)
+    if(!aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled || DPParams->numTxAntennas==1)
+    {
+        /* When BPM is enabled, order must be:
+           2D FFT -> Doppler compensation -> BPM decoding -> RX phase compensation */
+
+        /* Doppler compensation, BPM decoding and RX channel gain/phase offset compensation. */
+        AoAProcDSP_symbolCompensation(&res->angleFftIn[0],
+                               &aoaDspObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[0],
+                               dopplerSignIdx,
+                               DPParams->numTxAntennas,
+                               DPParams->numRxAntennas,
+                               DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev,
+                               DPParams->numDopplerBins,
+                               DPParams->isBpmEnabled);
+
+        /* Save elevation symbols before doing Azimuth FFT.*/
+        if(DPParams->numVirtualAntElev > 0)
         {
-            /* When BPM is enabled, order must be:
-               2D FFT -> Doppler compensation -> BPM decoding -> RX phase compensation */
-
-            /* Doppler compensation. */
-            AoAProcDSP_dopplerCompensation(
-                                   &res->angleFftIn[0],
-                                   &res->angleFftIn[0],
-                                   dopplerSignIdx,
-                                   DPParams->numTxAntennas,
-                                   DPParams->numRxAntennas,
-                                   DPParams->numVirtualAntAzim,
-                                   DPParams->numVirtualAntElev,
-                                   DPParams->numDopplerBins,
-                                   aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled);
-
-            if(DPParams->isBpmEnabled)
-            {/* BPM decoding*/
-                AoAProcDSP_decodeBPM(&res->angleFftIn[0], DPParams->numRxAntennas);
-            }
+            memcpy((void*)&elevationSymbols[0],
+                   (void*)&res->angleFftIn[DPParams->numVirtualAntAzim],
+                   DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
+        }
 
-            /* RX channel gain/phase offset compensation. */
-            AoAProcDSP_rxChanPhaseBiasCompensation(&aoaDspObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[0],
-                                                   DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev,
-                                                   &res->angleFftIn[0],
-                                                   &res->angleFftIn[0]);
+        /* Zero padding */
+        memset((void *) &res->angleFftIn[DPParams->numVirtualAntAzim], 0,
+               (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntAzim) * sizeof(cmplx32ReIm_t));
 
-            /* Save elevation symbols before doing Azimuth FFT.*/
-            if(DPParams->numVirtualAntElev > 0)
-            {
-                memcpy((void*)&elevationSymbols[0],
-                       (void*)&res->angleFftIn[DPParams->numVirtualAntAzim],
-                       DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
-            }
+        /* 3D-FFT (Azimuth FFT) */
+        DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
+                     DPU_AOAPROCDSP_NUM_ANGLE_BINS,
+                     (int32_t *) &res->angleFftIn[0],
+                     (int32_t *) &azimuthFftOut[0]);
+
+        /* Perform 3D elevation FFT if elevation virtual antennas are present*/
+        if(DPParams->numVirtualAntElev > 0)
+        {
+            /* Restore elevation symbols to FFT input buffer */
+            memcpy((void*)&res->angleFftIn[0],
+                   (void*)&elevationSymbols[0],
+                   DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
 
             /* Zero padding */
-            memset((void *) &res->angleFftIn[DPParams->numVirtualAntAzim], 0,
-                   (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntAzim) * sizeof(cmplx32ReIm_t));
+            memset((void *) &res->angleFftIn[DPParams->numVirtualAntElev], 0,
+                   (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntElev) * sizeof(cmplx32ReIm_t));
 
-            /* 3D-FFT (Azimuth FFT) */
+            /* 3D-FFT (Elevation FFT) */
             DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
                          DPU_AOAPROCDSP_NUM_ANGLE_BINS,
                          (int32_t *) &res->angleFftIn[0],
-                         (int32_t *) &azimuthFftOut[0]);
+                         (int32_t *) &res->elevationFftOut[0]);
+        }
+    }/* if extMaxVel disabled */
 
-            /* Perform 3D elevation FFT if elevation virtual antennas are present*/
-            if(DPParams->numVirtualAntElev > 0)
-            {
-                /* Restore elevation symbols to FFT input buffer */
-                memcpy((void*)&res->angleFftIn[0],
-                       (void*)&elevationSymbols[0],
-                       DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
+    if(DPParams->numTxAntennas>1 && aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled)
+    {
+        /* RX channel gain/phase offset compensation. */
+        AoAProcDSP_rxChanPhaseBiasCompensation(&aoaDspObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[0],
+                                           DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev,
+                                           &res->angleFftIn[0],
+                                           &res->angleFftIn[0]);
+
+        /* Doppler compensation, produce compensated symbols for all Doppler hypotheses. */
+        AoAProcDSP_dopplerCompensation(
+                               &res->angleFftIn[0],
+                               &hypothesesSymbols[0],
+                               dopplerSignIdx,
+                               DPParams->numTxAntennas,
+                               DPParams->numRxAntennas,
+                               DPParams->numVirtualAntAzim,
+                               DPParams->numVirtualAntElev,
+                               DPParams->numDopplerBins,
+                               aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled);
+
+        /* Perform 3D Azimuth FFT for each Doppler hypothesis and pick the one with highest peak power.
+           The hypotheses alternate between the Azimuth FFT output buffer and the temporary buffer,
+           the output of the best hypothesis so far is kept in place and the next one is written
+           to the other buffer, so the winner is copied at most once. */
+        hypFftOut[0] = azimuthFftOut;
+        hypFftOut[1] = azimuthFftOutTemp;
+        hypOutIdx = 0;
+        maxHypOutIdx = 0;
+        maxPow = 0;
+        maxHypIdx = 0;
+        for (hypIdx = 0; hypIdx < DPParams->numTxAntennas; hypIdx++)
+        {
+            /* Copy azimuth symbols of this hypothesis to angleFftIn buffer */
+            memcpy((void*)&res->angleFftIn[0],
+                   (void*)&hypothesesSymbols[hypIdx*(DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev)],
+   	                   DPParams->numVirtualAntAzim * sizeof(cmplx32ReIm_t));
+            /* Zero padding */
+            memset((void *) &res->angleFftIn[DPParams->numVirtualAntAzim], 0,
+                  (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntAzim) * sizeof(cmplx32ReIm_t));
 
-                /* Zero padding */
-                memset((void *) &res->angleFftIn[DPParams->numVirtualAntElev], 0,
-                       (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntElev) * sizeof(cmplx32ReIm_t));
+            /* 3D-FFT (Azimuth FFT) on this hypothesis*/
+            DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
+                        DPU_AOAPROCDSP_NUM_ANGLE_BINS,
+                        (int32_t *) &res->angleFftIn[0],
+                        (int32_t *) &hypFftOut[hypOutIdx][0]);
 
-                /* 3D-FFT (Elevation FFT) */
-                DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
+            /* peak power search on Azimuth FFT output of this hypothesis. */
+            mmwavelib_maxpow((int32_t *) &hypFftOut[hypOutIdx][0],
                              DPU_AOAPROCDSP_NUM_ANGLE_BINS,
-                             (int32_t *) &res->angleFftIn[0],
-                             (int32_t *) &res->elevationFftOut[0]);
+                             &maxPowTemp);
+
+            /* if this hypothesis has higher peak power, store its index and its Azimuth FFT output*/
+            if (maxPowTemp > maxPow)
+            {
+               maxPow = maxPowTemp;
+               maxHypIdx = hypIdx;
+               maxHypOutIdx = hypOutIdx;
+               hypOutIdx ^= 1;
             }
-        }/* if extMaxVel disabled */
+        }/* loop of all Doppler hypotheses */
 
-        if(DPParams->numTxAntennas>1 && aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled)
+        if (maxHypOutIdx != 0)
         {
-            /* RX channel gain/phase offset compensation. */
-            AoAProcDSP_rxChanPhaseBiasCompensation(&aoaDspObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[0],
-                                               DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev,
-                                               &res->angleFftIn[0],
-                                               &res->angleFftIn[0]);
-
-            /* Doppler compensation, produce compensated symbols for all Doppler hypotheses. */
-            AoAProcDSP_dopplerCompensation(
-                                   &res->angleFftIn[0],
-                                   &hypothesesSymbols[0],
-                                   dopplerSignIdx,
-                                   DPParams->numTxAntennas,
-                                   DPParams->numRxAntennas,
-                                   DPParams->numVirtualAntAzim,
-                                   DPParams->numVirtualAntElev,
-                                   DPParams->numDopplerBins,
-                                   aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled);
-
-            /* Perform 3D Azimuth FFT for each Doppler hypothesis and pick the one with highest peak power. */
-            maxPow = 0;
-            maxHypIdx = 0;
-            for (hypIdx = 0; hypIdx < DPParams->numTxAntennas; hypIdx++)
-            {
-                /* Copy azimuth symbols of this hypothesis to angleFftIn buffer */
-                memcpy((void*)&res->angleFftIn[0],
-                       (void*)&hypothesesSymbols[hypIdx*(DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev)],
-   	                   DPParams->numVirtualAntAzim * sizeof(cmplx32ReIm_t));
-                /* Zero padding */
-                memset((void *) &res->angleFftIn[DPParams->numVirtualAntAzim], 0,
-                      (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntAzim) * sizeof(cmplx32ReIm_t));
-
-                /* 3D-FFT (Azimuth FFT) on this hypothesis*/
-                DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
-                            DPU_AOAPROCDSP_NUM_ANGLE_BINS,
-                            (int32_t *) &res->angleFftIn[0],
-                            (int32_t *) &azimuthFftOutTemp[0]);
-
-                /* peak power search on Azimuth FFT output of this hypothesis. */
-                mmwavelib_maxpow((int32_t *) &azimuthFftOutTemp[0],
-                                 DPU_AOAPROCDSP_NUM_ANGLE_BINS,
-                                 &maxPowTemp);
-
-                /* if this hypothesis has higher peak power, store its index and its Azimuth FFT output*/
-                if (maxPowTemp > maxPow)
-                {
-                   maxPow = maxPowTemp;
-                   maxHypIdx = hypIdx;
-                   /* Copy from temp buffer to final Azimuth FFT output buffer.*/
-                   memcpy((void*)&azimuthFftOut[0],
-                          (void*)&azimuthFftOutTemp[0],
-                          DPU_AOAPROCDSP_NUM_ANGLE_BINS * sizeof(cmplx32ReIm_t));
-                }
-            }/* loop of all Doppler hypotheses */
+            /* Copy from temp buffer to final Azimuth FFT output buffer.*/
+            memcpy((void*)&azimuthFftOut[0],
+                   (void*)&azimuthFftOutTemp[0],
+                   DPU_AOAPROCDSP_NUM_ANGLE_BINS * sizeof(cmplx32ReIm_t));
+        }
 
-            /* If elevation virtual antennas are present, perform 3D elevation FFT for the picked Doppler hypothesis. */
-            if(DPParams->numVirtualAntElev > 0)
-            {
-                /* Copy elevation symbols to FFT input buffer */
-                memcpy((void*)&res->angleFftIn[0],
-                       (void*)&hypothesesSymbols[maxHypIdx*(DPParams->numVirtualAntAzim+DPParams->numVirtualAntElev)+DPParams->numVirtualAntAzim],
-                       DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
+        /* If elevation virtual antennas are present, perform 3D elevation FFT for the picked Doppler hypothesis. */
+        if(DPParams->numVirtualAntElev > 0)
+        {
+            /* Copy elevation symbols to FFT input buffer */
+            memcpy((void*)&res->angleFftIn[0],
+                   (void*)&hypothesesSymbols[maxHypIdx*(DPParams->numVirtualAntAzim+DPParams->numVirtualAntElev)+DPParams->numVirtualAntAzim],
+                   DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
 
-                /* Zero padding */
-                memset((void *) &res->angleFftIn[DPParams->numVirtualAntElev], 0,
-                       (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntElev) * sizeof(cmplx32ReIm_t));
+            /* Zero padding */
+            memset((void *) &res->angleFftIn[DPParams->numVirtualAntElev], 0,
+                   (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntElev) * sizeof(cmplx32ReIm_t));
 
-                /* 3D-FFT (Elevation FFT) */
-                DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
-                             DPU_AOAPROCDSP_NUM_ANGLE_BINS,
-                             (int32_t *) &res->angleFftIn[0],
-                             (int32_t *) &res->elevationFftOut[0]);
+            /* 3D-FFT (Elevation FFT) */
+            DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
+                         DPU_AOAPROCDSP_NUM_ANGLE_BINS,
+                         (int32_t *) &res->angleFftIn[0],
+                         (int32_t *) &res->elevationFftOut[0]);
+        }
+
+        wrapStartInd = - ((int32_t) (DPParams->numTxAntennas >> 1));
+        if (!(DPParams->numTxAntennas & 0x1) && (dopplerSignIdx < 0))
+        {
+            wrapStartInd++;
+        }
+        /* the signed Doppler index of the picked Doppler hypothesis */
+        dopplerSignIdx += (wrapStartInd + maxHypIdx) * (int32_t) DPParams->numDopplerBins;
+
+    }/*extMaxVelCfg.enabled and numTx>1*/
+
+    /* Angle estimation*/
+    objOutIdx = AoAProcDSP_angleEstimationAzimElev(aoaDspObj,
+                                                   objInCfarIdx,
+                                                   objOutIdx,
+                                                   dopplerSignIdx);
+
+    return objOutIdx;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    AoA processing when there are more than one virtual antennas.\n
+ *    If @ref DPU_AoAProcDSP_HW_Resources::rangeGroupIdxBuf and
+ *    @ref DPU_AoAProcDSP_HW_Resources::dopplerFftRowBuf are provided, objects are
+ *    processed in ascending range bin order: each radar cube row is fetched and
+ *    Doppler transformed once, and the angle estimation of all objects on that row
+ *    picks its Doppler bin from the row buffer. Each object writes to its own output
+ *    slots, which are compacted at the end, so the output list is the same as with
+ *    per object processing. This needs one slot per possible point, so if the
+ *    multi peak search could produce more points than @ref DPU_AoAProcDSP_HW_Resources::detObjOutMaxSize,
+ *    or without the buffers, the radar cube row is fetched per object, in CFAR list order.
+ *
+ *  @param[in]    aoaDspObj   DPU object
+ *  @param[in]    numObjsIn   Number of objects in CFAR list
+ *  @param[out]   numObjsOut  Number of detected objects in the output list
+ *  @param[inout] waitTime    CPU waiting time
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success     - 0
+ *  @retval
+ *      Error       - <0
+ *            
+ */
+static inline uint32_t AoAProcDSP_processMultipleVirtualAntennas
+(
+    AOADspObj                 *aoaDspObj,
+    uint32_t                  numObjsIn,
+    uint32_t                  *numObjsOut,
+    volatile uint32_t         *waitTime
+)
+{
+    uint32_t idx, cfarIdx, virtAntIdx, numVirtAnt, slotsPerObj;
+    uint16_t rangeIdx, dopplerIdx;
+    DPU_AoAProcDSP_HW_Resources *res;
+    DPU_AoAProcDSP_StaticConfig *DPParams;
+    cmplx32ReIm_t *dopplerRow;
+    uint32_t  numObjsOutLocal = 0;
+    int32_t  retVal = 0;
+
+    res = &aoaDspObj->res;
+    DPParams = &aoaDspObj->params;
+
+    /* Up to two points per object with the multi peak search, one otherwise */
+    slotsPerObj = aoaDspObj->dynLocalCfg.multiObjBeamFormingCfg.enabled ? 2U : 1U;
+
+    if ((res->rangeGroupIdxBuf == NULL) || (res->dopplerFftRowBuf == NULL) ||
+        (slotsPerObj * numObjsIn > res->detObjOutMaxSize))
+    {
+        /* Angle estimation for each object */
+        for (idx = 0; idx < numObjsIn; idx++)
+        {
+            retVal = AoAProcDSP_dopplerFftRangeBin(aoaDspObj,
+                                                   res->cfarRngDopSnrList[idx].rangeIdx,
+                                                   res->cfarRngDopSnrList[idx].dopplerIdx,
+                                                   NULL,
+                                                   waitTime);
+            if (retVal != 0)
+            {
+                goto exit;
             }
 
-            wrapStartInd = - ((int32_t) (DPParams->numTxAntennas >> 1));
-            if (!(DPParams->numTxAntennas & 0x1) && (dopplerSignIdx < 0))
+            numObjsOutLocal = AoAProcDSP_angleEstimationObj(aoaDspObj, idx, numObjsOutLocal);
+
+            if(numObjsOutLocal >= res->detObjOutMaxSize)
             {
-                wrapStartInd++;
+                /*Stop processing CFAR list as the limit for number of detected objects was reached*/
+                goto exit;
             }
-            /* the signed Doppler index of the picked Doppler hypothesis */
-            dopplerSignIdx += (wrapStartInd + maxHypIdx) * (int32_t) DPParams->numDopplerBins;
+        }/* for (idx = 0; idx < numObjsIn; idx++) */
+    }
+    else
+    {
+        numVirtAnt = DPParams->numTxAntennas * DPParams->numRxAntennas;
+        dopplerRow = res->dopplerFftRowBuf;
 
-        }/*extMaxVelCfg.enabled and numTx>1*/
+        AoAProcDSP_sortByRangeIdx(aoaDspObj, numObjsIn);
 
-        /* Angle estimation*/
-        numObjsOutLocal = AoAProcDSP_angleEstimationAzimElev(aoaDspObj,
-                                                             idx,
-                                                             numObjsOutLocal,
-                                                             dopplerSignIdx);
+        memset((void *)res->detObj2dAzimIdx, DPU_AOAPROCDSP_EMPTY_OUT_SLOT, slotsPerObj * numObjsIn);
 
-        if(numObjsOutLocal >= res->detObjOutMaxSize)
+        idx = 0;
+        while (idx < numObjsIn)
         {
-            /*Stop processing CFAR list as the limit for number of detected objects was reached*/
-            goto exit;
+            /* Fetch the radar cube row once for all objects on this range bin */
+            rangeIdx = res->cfarRngDopSnrList[res->rangeGroupIdxBuf[idx]].rangeIdx;
+            retVal = AoAProcDSP_dopplerFftRangeBin(aoaDspObj,
+                                                   rangeIdx,
+                                                   0,
+                                                   dopplerRow,
+                                                   waitTime);
+            if (retVal != 0)
+            {
+                goto exit;
+            }
+
+            for ( ; idx < numObjsIn; idx++)
+            {
+                cfarIdx = res->rangeGroupIdxBuf[idx];
+                if (res->cfarRngDopSnrList[cfarIdx].rangeIdx != rangeIdx)
+                {
+                    break;
+                }
+
+                /* Gather the object's Doppler bin of all virtual antennas */
+                dopplerIdx = res->cfarRngDopSnrList[cfarIdx].dopplerIdx;
+                for (virtAntIdx = 0; virtAntIdx < numVirtAnt; virtAntIdx++)
+                {
+                    res->angleFftIn[virtAntIdx] = dopplerRow[virtAntIdx * DPParams->numDopplerBins + dopplerIdx];
+                }
+
+                AoAProcDSP_angleEstimationObj(aoaDspObj, cfarIdx, slotsPerObj * cfarIdx);
+            }
         }
 
-    }/* for (idx = 0; idx < numObjsIn; idx++) */
+        numObjsOutLocal = AoAProcDSP_compactOutputSlots(aoaDspObj, slotsPerObj * numObjsIn);
+    }
 
 exit:
     *numObjsOut = numObjsOutLocal;
@@ -1546,6 +1817,30 @@ int32_t DPU_AoAProcDSP_config
             goto exit;
     }
 
+    /* Range bin grouping is optional, but needs both of its buffers */
+    if ((aoaDspCfg->res.rangeGroupIdxBuf != NULL) && (aoaDspCfg->res.dopplerFftRowBuf != NULL))
+    {
+        if (MEM_IS_NOT_ALIGN(aoaDspCfg->res.rangeGroupIdxBuf, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT) ||
+            MEM_IS_NOT_ALIGN(aoaDspCfg->res.dopplerFftRowBuf, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT))
+        {
+            retVal = DPU_AOAPROCDSP_ENOMEMALIGN_BUFF;
+            goto exit;
+        }
+
+        if ((aoaDspCfg->res.rangeGroupIdxSize < sizeof(uint16_t) * aoaDspCfg->res.detObjOutMaxSize) ||
+            (aoaDspCfg->res.dopplerFftRowSize < sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numTxAntennas *
+                                                aoaDspCfg->staticCfg.numRxAntennas * aoaDspCfg->staticCfg.numDopplerBins))
+        {
+            retVal = DPU_AOAPROCDSP_ESCRATCHSIZE;
+            goto exit;
+        }
+    }
+    else if ((aoaDspCfg->res.rangeGroupIdxBuf != NULL) || (aoaDspCfg->res.dopplerFftRowBuf != NULL))
+    {
+        retVal = DPU_AOAPROCDSP_EINVAL;
+        goto exit;
+    }
+
     /* Check Heatmap configuration */
     if (aoaDspCfg->dynCfg.prepareRangeAzimuthHeatMap)
     {
@@ -0,0 +1,215 @@
+/**
+ *   @file  aoaprocdsp_symbolcomp.c
+ *
+ *   @brief
+ *      Implements the virtual antenna symbol compensation shared by the DSP AoA
+ *      DPUs (aoaproc and aoaprocdcmp).
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* mmWave SDK drivers/common Include Files */
+#include <ti/common/sys_common.h>
+
+/* mmWave lib*/
+#include <ti/alg/mmwavelib/mmwavelib.h>
+
+/* Data Path Include Files */
+#include <ti/datapath/dpc/dpu/aoaproc/include/aoaprocdsp_symbolcomp.h>
+#include <ti/utils/mathutils/mathutils.h>
+
+/* C674x mathlib */
+/* Suppress the mathlib.h warnings
+ *  #48-D: incompatible redefinition of macro "TRUE"
+ *  #48-D: incompatible redefinition of macro "FALSE"
+ */
+#pragma diag_push
+#pragma diag_suppress 48
+#include <ti/mathlib/mathlib.h>
+#pragma diag_pop
+
+
+/*===========================================================
+ *                    Internal Functions
+ *===========================================================*/
+/**
+ *  @b Description
+ *  @n
+ *      Rotates a single antenna symbol by the Doppler compensation phase.
+ *
+ *  @param[in]  in           Pointer to the Input Symbol
+ *
+ *  @param[out] out          Pointer to the Output Symbol
+ *
+ *  @param[in]  Cos          Cosine value depending on doppler index
+ *
+ *  @param[in]  Sin          Sine value depending on doppler index
+ *
+ *  @retval None
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static inline void AoAProcDSP_symbolRotate
+(
+    cmplx32ReIm_t *in,
+    cmplx32ReIm_t *out,
+    float  Cos,
+    float  Sin
+)
+{
+    float           yRe, yIm;
+
+    /* Rotate symbol (correct the phase) */
+    yRe = in->real * Cos + in->imag * Sin;
+    yIm = in->imag * Cos - in->real * Sin;
+    out->real = (int32_t) yRe;
+    out->imag = (int32_t) yIm;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Compensates the virtual antenna symbols of a detected object in a single
+ *    pass per Tx antenna. It performs Doppler compensation, BPM decoding of the
+ *    Tx0/Tx1 symbol pairs when BPM is enabled, and then rx channel phase/gain
+ *    compensation. The result is identical to running the Doppler compensation of
+ *    the DPU (with extended maximum velocity disabled), BPM decoding and the rx
+ *    channel phase/gain compensation in sequence. The symbols of one detected
+ *    object are processed per call, with scalar float rotations.
+ *
+ * @param[inout]  symbols        Pointer to antenna symbols, compensated in place
+ *
+ * @param[in]     rxChComp       Rx channel phase/gain compensation coefficients
+ *
+ * @param[in]     dopplerSignIdx Doppler Index (the signed value)
+ *
+ * @param[in]     numTxAnt       Number of Tx antennas
+ *
+ * @param[in]     numRxAnt       Number of physical Rx antennas
+ *
+ * @param[in]     numVirtualAnt  Number of virtual antennas (azimuth + elevation)
+ *
+ * @param[in]     numDopplerBins Number of Doppler bins
+ *
+ * @param[in]     isBpmEnabled   BPM decoding flag
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void AoAProcDSP_symbolCompensation
+(
+    cmplx32ReIm_t *symbols,
+    cmplx16ImRe_t *rxChComp,
+    int32_t  dopplerSignIdx,
+    uint32_t numTxAnt,
+    uint32_t numRxAnt,
+    uint32_t numVirtualAnt,
+    uint32_t numDopplerBins,
+    bool     isBpmEnabled
+)
+{
+    cmplx32ReIm_t *bpmAPtr;
+    cmplx32ReIm_t *bpmBPtr;
+    float       dopplerCompensationIdx;
+    float       Cos, Sin, temp;
+    int32_t     real, imag;
+    uint32_t    virtAntIdx;
+    uint32_t    txAntIdx;
+    uint32_t    idx;
+
+    if(numTxAnt > 1)
+    {
+        dopplerCompensationIdx = dopplerSignIdx / (float)numTxAnt;
+        Cos = cossp(2*PI_*dopplerCompensationIdx/numDopplerBins);
+        Sin = sinsp(2*PI_*dopplerCompensationIdx/numDopplerBins);
+
+        bpmAPtr  = &symbols[0];
+        bpmBPtr  = &symbols[numRxAnt];
+        if(isBpmEnabled)
+        {
+            /* Tx1 symbols: Doppler compensation followed by BPM decoding
+               against the Tx0 symbols */
+            for(idx = 0; idx < numRxAnt; idx++)
+            {
+                AoAProcDSP_symbolRotate(&bpmBPtr[idx], &bpmBPtr[idx], Cos, Sin);
+
+                real = bpmAPtr[idx].real;
+                imag = bpmAPtr[idx].imag;
+                bpmAPtr[idx].real = (real + bpmBPtr[idx].real)/2;
+                bpmAPtr[idx].imag = (imag + bpmBPtr[idx].imag)/2;
+                bpmBPtr[idx].real = (real - bpmBPtr[idx].real)/2;
+                bpmBPtr[idx].imag = (imag - bpmBPtr[idx].imag)/2;
+            }
+        }
+        else
+        {
+            for(idx = 0; idx < numRxAnt; idx++)
+            {
+                AoAProcDSP_symbolRotate(&bpmBPtr[idx], &bpmBPtr[idx], Cos, Sin);
+            }
+        }
+
+        virtAntIdx = 2 * numRxAnt;
+        for(txAntIdx = 2; txAntIdx < numTxAnt; txAntIdx++)
+        {
+            /* Increment Doppler phase shift */
+            temp = Cos * Cos - Sin * Sin;
+            Sin = 2 * Cos * Sin;
+            Cos = temp;
+
+            for(idx = 0; idx < numRxAnt; idx++)
+            {
+                AoAProcDSP_symbolRotate(&symbols[virtAntIdx], &symbols[virtAntIdx], Cos, Sin);
+                virtAntIdx++;
+            }
+        }
+    }
+
+    /* RX channel gain/phase offset compensation. Note that symbols are in ReIm format
+       and rxChComp coefficients are in ImRe format */
+    mmwavelib_vecmul16x32_anylen((uint32_t *)rxChComp, /*ImRe*/
+                                 (int64_t *)symbols,   /*ReIm*/
+                                 (int64_t *)symbols,   /*ReIm*/
+                                 numVirtualAnt);
+}
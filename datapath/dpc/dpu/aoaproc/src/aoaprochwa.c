@@ -1851,13 +1851,16 @@ static uint32_t AoAProcHWA_angleEstimationAzimElev
     dopplerSignIdx += (wrapStartInd + hypothesisMaxIdx) * (int16_t) numDopplerBins;
 
     /* Estimate x,y,z */
-    objOutIdx = AoAProcHWA_XYZestimation(aoaHwaObj,
-                                         pingPongIdx,
-                                         objInIdx,
-                                         objOutIdx,
-                                         maxIdx,
-                                         dopplerSignIdx,
-                                         hypothesisMaxIdx);
+    if (aoaHwaObj->dynLocalCfg.fovAoaLocalCfg.azimuthBinMask[maxIdx])
+    {
+        objOutIdx = AoAProcHWA_XYZestimation(aoaHwaObj,
+                                             pingPongIdx,
+                                             objInIdx,
+                                             objOutIdx,
+                                             maxIdx,
+                                             dopplerSignIdx,
+                                             hypothesisMaxIdx);
+    }
 
     if (objOutIdx >= maxNumObj)
     {
@@ -1913,7 +1916,8 @@ static uint32_t AoAProcHWA_angleEstimationAzimElev
             }
         }
         /* Is second peak greater than threshold? */
-        if ( (maxVal2 >( ((uint32_t)(maxVal * aoaHwaObj->dynLocalCfg.multiObjBeamFormingCfg.multiPeakThrsScal)))) && (objOutIdx < maxNumObj) )
+        if ( (maxVal2 >( ((uint32_t)(maxVal * aoaHwaObj->dynLocalCfg.multiObjBeamFormingCfg.multiPeakThrsScal)))) && (objOutIdx < maxNumObj) &&
+             aoaHwaObj->dynLocalCfg.fovAoaLocalCfg.azimuthBinMask[azimIdx])
         {
 
             /* Estimate x,y,z for second peak */
@@ -2097,7 +2101,9 @@ exit:
  *  @b Description
  *  @n
  *      The function converts angle of arrival field of view values specified
- *      in degrees to the values appropriate for internal DPU comparison.
+ *      in degrees to the values appropriate for internal DPU comparison. It also
+ *      builds the azimuth angle bin mask, so that the peaks outside of the field
+ *      of view are rejected before the x/y/z estimation.
  *
  *  @param[in]  aoaHwaObj    Pointer to internal AoAProcHWA data object
  *
@@ -2111,10 +2117,48 @@ exit:
 void AoAProcHWA_ConvertFov(AOAHwaObj *aoaHwaObj,
                            DPU_AoAProc_FovAoaCfg *fovAoaCfg)
 {
+    DPU_AoAProc_fovAoaLocalCfg *fovAoaLocalCfg = &aoaHwaObj->dynLocalCfg.fovAoaLocalCfg;
+    float lambdaOverDist = aoaHwaObj->params.lambdaOverDist;
+    float minSineVal, maxSineVal, sineVal, Wx;
+    int32_t sBinIdx;
+    uint32_t binIdx;
+
     aoaHwaObj->dynLocalCfg.fovAoaLocalCfg.minAzimuthSineVal = sin(fovAoaCfg->minAzimuthDeg / 180. * PI_);
     aoaHwaObj->dynLocalCfg.fovAoaLocalCfg.maxAzimuthSineVal = sin(fovAoaCfg->maxAzimuthDeg / 180. * PI_);
     aoaHwaObj->dynLocalCfg.fovAoaLocalCfg.minElevationSineVal = sin(fovAoaCfg->minElevationDeg / 180. * PI_);
     aoaHwaObj->dynLocalCfg.fovAoaLocalCfg.maxElevationSineVal = sin(fovAoaCfg->maxElevationDeg  / 180. * PI_);
+
+    /* Azimuth bin mask. The azimuth limits are scaled in the field of view check
+       by the elevation term (limitScale <= 1), so with elevation antennas a bin can
+       pass it only if its sine value is within [min(minAzimuthSine, 0), max(maxAzimuthSine, 0)].
+       The sine value is computed the same way as in the field of view check. */
+    minSineVal = fovAoaLocalCfg->minAzimuthSineVal;
+    maxSineVal = fovAoaLocalCfg->maxAzimuthSineVal;
+    if (aoaHwaObj->params.numVirtualAntElev > 0)
+    {
+        if (minSineVal > 0)
+        {
+            minSineVal = 0;
+        }
+        if (maxSineVal < 0)
+        {
+            maxSineVal = 0;
+        }
+    }
+    for (binIdx = 0; binIdx < DPU_AOAPROCHWA_NUM_ANGLE_BINS; binIdx++)
+    {
+        if (binIdx > (DPU_AOAPROCHWA_NUM_ANGLE_BINS/2 -1))
+        {
+            sBinIdx = (int32_t) binIdx - (int32_t) DPU_AOAPROCHWA_NUM_ANGLE_BINS;
+        }
+        else
+        {
+            sBinIdx = (int32_t) binIdx;
+        }
+        Wx = 2 * (float) sBinIdx / DPU_AOAPROCHWA_NUM_ANGLE_BINS;
+        sineVal = (lambdaOverDist/2)*Wx;
+        fovAoaLocalCfg->azimuthBinMask[binIdx] = (uint8_t) ((sineVal >= minSineVal) && (sineVal <= maxSineVal));
+    }
 }
 
 /**
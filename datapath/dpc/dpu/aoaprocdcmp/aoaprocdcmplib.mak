@@ -7,6 +7,8 @@
 # Setup the VPATH:
 ###################################################################################
 vpath %.c src
+# Symbol compensation shared with the aoaproc DSP DPU
+vpath %.c $(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpc/dpu/aoaproc/src
 
 ###################################################################################
 # Library Source Files:
@@ -15,7 +17,8 @@ vpath %.c src
 ifneq ($(filter $(MMWAVE_SDK_DEVICE_TYPE),xwr18xx xwr68xx), )
 AOAPROCDCMP_HWA_LIB_SOURCES = aoaprocdcmphwa.c
 endif
-AOAPROCDCMP_DSP_LIB_SOURCES = aoaprocdcmpdsp.c 			
+AOAPROCDCMP_DSP_LIB_SOURCES = aoaprocdcmpdsp.c \
+							  aoaprocdsp_symbolcomp.c
 
 ###################################################################################
 # Library objects
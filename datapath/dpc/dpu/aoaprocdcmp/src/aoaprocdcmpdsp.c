@@ -59,6 +59,7 @@
 /* Data Path Include Files */
 #include <ti/datapath/dpedma/dpedma.h>
 #include <ti/datapath/dpc/dpu/aoaprocdcmp/include/aoaprocdcmpdsp_internal.h>
+#include <ti/datapath/dpc/dpu/aoaproc/include/aoaprocdsp_symbolcomp.h>
 #include <ti/utils/cycleprofiler/cycle_profiler.h>
 #include <ti/utils/mathutils/mathutils.h>
 
@@ -1010,42 +1011,6 @@ static inline void AoAProcDcmpDSP_generateTables
                                          DPU_AOAPROCDCMPDSP_NUM_ANGLE_BINS);
 }
 
-/**
- *  @b Description
- *  @n
- *    Decodes BPM 
- *
- * @param[inout]  virtAntennaBuf : Pointer to antenna symbols 
- *            
- * @param[in]  numRxAnt  : Number of RX antennas
- 
- *  @retval
- *      Not Applicable.
- */
-static inline void AoAProcDcmpDSP_decodeBPM(cmplx32ReIm_t *virtAntennaBuf, uint16_t numRxAnt)
-{
-    cmplx32ReIm_t *bpmAPtr;
-    cmplx32ReIm_t *bpmBPtr;
-    int32_t real, imag, idx;
-
-    bpmAPtr  = &virtAntennaBuf[0];
-    bpmBPtr  = &virtAntennaBuf[numRxAnt];
-    
-    for(idx = 0; idx < numRxAnt; idx++)
-    {        
-        /*BPM decoding*/                        
-        /*store A*/
-        real = bpmAPtr[idx].real;
-        imag = bpmAPtr[idx].imag;
-        /*compute S1 and store in place*/
-        bpmAPtr[idx].real = (bpmAPtr[idx].real + bpmBPtr[idx].real)/2;
-        bpmAPtr[idx].imag = (bpmAPtr[idx].imag + bpmBPtr[idx].imag)/2;
-        /*compute S2 and store in place*/
-        bpmBPtr[idx].real = (real - bpmBPtr[idx].real)/2;
-        bpmBPtr[idx].imag = (imag - bpmBPtr[idx].imag)/2;
-    }
-}
-
 /**
  *  @b Description
  *  @n
@@ -1090,6 +1055,8 @@ static inline uint32_t AoAProcDcmpDSP_processMultipleVirtualAntennas
     /* for extMaxVelocity feature: */
     cmplx32ReIm_t *hypothesesSymbols;
     cmplx32ReIm_t *azimuthFftOutTemp;
+    cmplx32ReIm_t *hypFftOut[2];
+    uint32_t  hypOutIdx, maxHypOutIdx;
     int32_t   dopplerSignIdx;
     int32_t   hypIdx, maxHypIdx;
     float32_t maxPow, maxPowTemp;
@@ -1234,28 +1201,15 @@ static inline uint32_t AoAProcDcmpDSP_processMultipleVirtualAntennas
             /* When BPM is enabled, order must be:
                2D FFT -> Doppler compensation -> BPM decoding -> RX phase compensation */
 
-            /* Doppler compensation. */
-            AoAProcDcmpDSP_dopplerCompensation(
-                                   &res->angleFftIn[0],
-                                   &res->angleFftIn[0],
-                                   dopplerSignIdx,
-                                   DPParams->numTxAntennas,
-                                   DPParams->numRxAntennas,
-                                   DPParams->numVirtualAntAzim,
-                                   DPParams->numVirtualAntElev,
-                                   DPParams->numDopplerBins,
-                                   aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled);
-
-            if(DPParams->isBpmEnabled)
-            {/* BPM decoding*/
-                AoAProcDcmpDSP_decodeBPM(&res->angleFftIn[0], DPParams->numRxAntennas);
-            }
-
-            /* RX channel gain/phase offset compensation. */
-            AoAProcDcmpDSP_rxChanPhaseBiasCompensation(&aoaDspObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[0],
-                                                   DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev,
-                                                   &res->angleFftIn[0],
-                                                   &res->angleFftIn[0]);
+            /* Doppler compensation, BPM decoding and RX channel gain/phase offset compensation. */
+            AoAProcDSP_symbolCompensation(&res->angleFftIn[0],
+                               &aoaDspObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[0],
+                               dopplerSignIdx,
+                               DPParams->numTxAntennas,
+                               DPParams->numRxAntennas,
+                               DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev,
+                               DPParams->numDopplerBins,
+                               DPParams->isBpmEnabled);
 
             /* Save elevation symbols before doing Azimuth FFT.*/
             if(DPParams->numVirtualAntElev > 0)
@@ -1315,7 +1269,14 @@ static inline uint32_t AoAProcDcmpDSP_processMultipleVirtualAntennas
                                    DPParams->numDopplerBins,
                                    aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled);
 
-            /* Perform 3D Azimuth FFT for each Doppler hypothesis and pick the one with highest peak power. */
+            /* Perform 3D Azimuth FFT for each Doppler hypothesis and pick the one with highest peak power.
+               The hypotheses alternate between the Azimuth FFT output buffer and the temporary buffer,
+               the output of the best hypothesis so far is kept in place and the next one is written
+               to the other buffer, so the winner is copied at most once. */
+            hypFftOut[0] = azimuthFftOut;
+            hypFftOut[1] = azimuthFftOutTemp;
+            hypOutIdx = 0;
+            maxHypOutIdx = 0;
             maxPow = 0;
             maxHypIdx = 0;
             for (hypIdx = 0; hypIdx < DPParams->numTxAntennas; hypIdx++)
@@ -1332,10 +1293,10 @@ static inline uint32_t AoAProcDcmpDSP_processMultipleVirtualAntennas
                 DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
                             DPU_AOAPROCDCMPDSP_NUM_ANGLE_BINS,
                             (int32_t *) &res->angleFftIn[0],
-                            (int32_t *) &azimuthFftOutTemp[0]);
+                            (int32_t *) &hypFftOut[hypOutIdx][0]);
 
                 /* peak power search on Azimuth FFT output of this hypothesis. */
-                mmwavelib_maxpow((int32_t *) &azimuthFftOutTemp[0],
+                mmwavelib_maxpow((int32_t *) &hypFftOut[hypOutIdx][0],
                                  DPU_AOAPROCDCMPDSP_NUM_ANGLE_BINS,
                                  &maxPowTemp);
 
@@ -1344,13 +1305,19 @@ static inline uint32_t AoAProcDcmpDSP_processMultipleVirtualAntennas
                 {
                    maxPow = maxPowTemp;
                    maxHypIdx = hypIdx;
-                   /* Copy from temp buffer to final Azimuth FFT output buffer.*/
-                   memcpy((void*)&azimuthFftOut[0],
-                          (void*)&azimuthFftOutTemp[0],
-                          DPU_AOAPROCDCMPDSP_NUM_ANGLE_BINS * sizeof(cmplx32ReIm_t));
+                   maxHypOutIdx = hypOutIdx;
+                   hypOutIdx ^= 1;
                 }
             }/* loop of all Doppler hypotheses */
 
+            if (maxHypOutIdx != 0)
+            {
+                /* Copy from temp buffer to final Azimuth FFT output buffer.*/
+                memcpy((void*)&azimuthFftOut[0],
+                       (void*)&azimuthFftOutTemp[0],
+                       DPU_AOAPROCDCMPDSP_NUM_ANGLE_BINS * sizeof(cmplx32ReIm_t));
+            }
+
             /* If elevation virtual antennas are present, perform 3D elevation FFT for the picked Doppler hypothesis. */
             if(DPParams->numVirtualAntElev > 0)
             {
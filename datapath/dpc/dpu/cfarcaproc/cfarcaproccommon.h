@@ -208,6 +208,14 @@
  * In this output list, side information of noise and SNR is also populated for each of the generated points. The
  * SNR is calculated using the noise and the detection matrix value corresponding to the detected range,doppler position.
  *
+ * A detection budget can be set through @ref DPU_CFARCAProcDSP_DynamicConfig::detBudget or
+ * @ref DPU_CFARCAProcDSP_control (@ref DPU_CFARCAProcDSP_Cmd_DetBudgetCfg). With the budget enabled, the
+ * list is not truncated in scan order when it is full. Instead a bounded min-heap keyed on SNR is maintained
+ * while scanning, so the @ref DPU_CFARCAProc_DetBudgetCfg::maxNumDetObj strongest detections are kept. The
+ * kept detections are put back in scan order before peak grouping so that the grouping result does not
+ * depend on the selection. The heap needs an additional cfarRngDopSnrListSize * sizeof(uint16_t) of
+ * @ref DPU_CFARCAProcDSP_HW_Resources::cfarScrachBuffer.
+ *
  * If both CFAR doopler and range domain processing are enabled, then noise is taken from range domain processing.
  * If only one processing domain is enabled, the noise is from the enabed processing domain.
  * 
@@ -239,7 +247,8 @@
  *      - @ref DPU_CFARCAProcDSP_Cmd_CfarRangeCfg,
  *      - @ref DPU_CFARCAProcDSP_Cmd_CfarDopplerCfg,
  *      - @ref DPU_CFARCAProcDSP_Cmd_FovRangeCfg,
- *      - @ref DPU_CFARCAProcDSP_Cmd_FovDopplerCfg
+ *      - @ref DPU_CFARCAProcDSP_Cmd_FovDopplerCfg,
+ *      - @ref DPU_CFARCAProcDSP_Cmd_DetBudgetCfg
  *
  *  Full API details can be seen at @ref CFARCA_PROC_DPU_EXTERNAL */
 
@@ -392,6 +401,21 @@ typedef struct DPU_CFARCAProc_FovCfg_t
     float max;
 } DPU_CFARCAProc_FovCfg;
 
+/*!
+ *  @brief    Detection budget configuration
+ *
+ *  \ingroup DPU_CFARCAPROC_EXTERNAL_DATA_STRUCTURE
+ *
+ */
+typedef struct DPU_CFARCAProc_DetBudgetCfg_t
+{
+    /*! @brief Maximum number of detected objects kept per frame. When the CFAR
+     *         detects more objects than this, only the ones with the highest SNR
+     *         are kept. 0 disables the budget, in which case the list is truncated
+     *         in scan order when it is full. */
+    uint16_t maxNumDetObj;
+} DPU_CFARCAProc_DetBudgetCfg;
+
 
 #ifdef __cplusplus
 }
@@ -211,7 +211,10 @@ extern "C" {
      DPU_CFARCAProcDSP_Cmd_FovRangeCfg,
 
      /*! @brief Command to update field of view in Doppler domain, minimum and maximum Doppler limits */
-     DPU_CFARCAProcDSP_Cmd_FovDopplerCfg
+     DPU_CFARCAProcDSP_Cmd_FovDopplerCfg,
+
+     /*! @brief Command to update the detection budget, maximum number of detected objects kept per frame */
+     DPU_CFARCAProcDSP_Cmd_DetBudgetCfg
 }DPU_CFARCAProcDSP_Cmd;
 
 
@@ -274,7 +277,10 @@ typedef struct DPU_CFARCAProcDSP_HW_Resources_t
     uint16_t            *cfarScrachBuffer;
 
     /*! @brief      Scratch buffer size for cfar peak grouping.
-     *              size = 4 * @ref cfarRngDopSnrListSize * sizeof(uint16_t) */
+     *              size = 4 * @ref cfarRngDopSnrListSize * sizeof(uint16_t).
+     *              The detection budget (@ref DPU_CFARCAProc_DetBudgetCfg) needs
+     *              size = 6 * @ref cfarRngDopSnrListSize * sizeof(uint16_t), without it
+     *              the budget cannot be enabled */
     uint32_t            cfarScrachBufferSize;
 } DPU_CFARCAProcDSP_HW_Resources;
 
@@ -301,6 +307,9 @@ typedef struct DPU_CFARCAProcDSP_DynamicConfig_t
 
     /*! @brief      Field of view configuration in Doppler domain */
     DPU_CFARCAProc_FovCfg *fovDoppler;
+
+    /*! @brief      Detection budget configuration. NULL disables the budget */
+    DPU_CFARCAProc_DetBudgetCfg *detBudget;
 } DPU_CFARCAProcDSP_DynamicConfig;
 
 /**
@@ -141,6 +141,21 @@ typedef struct CFARCADspObj_t
     /*!@brief       Peak grouping internal buffer - Peak index */
     uint16_t            *detObjPeakIdxBuf;
 
+    /*!@brief       Detection budget min-heap of cfarRngDopSnrList indices, keyed by
+                    @ref detObjHeapKeyBuf. NULL if the scratch buffer is too small to hold it */
+    uint16_t            *detObjHeapBuf;
+
+    /*!@brief       Detection budget key (SNR in detection matrix Q format) of each
+                    cfarRngDopSnrList index. NULL if the scratch buffer is too small to hold it */
+    uint16_t            *detObjHeapKeyBuf;
+
+    /*! @brief      Detection budget configuration */
+    DPU_CFARCAProc_DetBudgetCfg detBudget;
+
+    /*! @brief      Number of detected objects kept with the detection budget,
+                    0 when the budget is disabled */
+    uint32_t            detBudgetLimit;
+
     /*! @brief total number of calls of DPU processing */
     uint32_t            numProcess;
 }CFARCADspObj;
@@ -120,6 +120,29 @@ static uint32_t CFARCADSP_peakGrouping
     CFARCADspObj      *cfarObj,
     uint16_t          numDetectedObjs
 );
+static void CFARCADSP_setDetBudget
+(
+    CFARCADspObj      *cfarObj
+);
+static inline uint16_t CFARCADSP_detBudgetKey
+(
+    uint16_t          peakVal,
+    uint16_t          noiseVal
+);
+static bool CFARCADSP_detBudgetInsert
+(
+    CFARCADspObj      *cfarObj,
+    uint32_t          *numDetObj,
+    uint16_t          key,
+    uint32_t          *detSlot
+);
+static void CFARCADSP_detBudgetRestoreScanOrder
+(
+    CFARCADspObj      *cfarObj,
+    uint32_t          numDetObj,
+    uint8_t           peakGrpingEn,
+    bool              rangeMajor
+);
 static int32_t CFARCADSP_processDopplerDomain
 (
     CFARCADspObj    *cfarObj,
@@ -560,6 +583,290 @@ static void CFARCADSP_setCfarDetMaskLine
     cfarDetOutBitMask[word] |= (0x1 << bit);
 }
 
+/**
+ *  @b Description
+ *  @n
+ *     Derives the number of detected objects kept per frame from the detection
+ *     budget configuration. The budget is clamped to the size of the detection
+ *     list and disabled when the heap buffer could not be allocated.
+ *
+ *  @param[in] cfarObj              Pointer to CFAR DPU object
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      None
+ *
+ */
+static void CFARCADSP_setDetBudget
+(
+    CFARCADspObj      *cfarObj
+)
+{
+    if ((cfarObj->detObjHeapBuf == NULL) || (cfarObj->detBudget.maxNumDetObj == 0U))
+    {
+        cfarObj->detBudgetLimit = 0U;
+    }
+    else if (cfarObj->detBudget.maxNumDetObj > cfarObj->res.cfarRngDopSnrListSize)
+    {
+        cfarObj->detBudgetLimit = cfarObj->res.cfarRngDopSnrListSize;
+    }
+    else
+    {
+        cfarObj->detBudgetLimit = cfarObj->detBudget.maxNumDetObj;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *     Returns the detection budget key of a detected object, its SNR in the
+ *     log2 Q format of the detection matrix (@ref DPIF_DETMATRIX_DATA_QFORMAT).
+ *     Unlike the SNR in whole dB of the detection list, it orders objects
+ *     whose SNR differ by less than one dB.
+ *
+ *  @param[in] peakVal              Detection matrix value of the object
+ *  @param[in] noiseVal             CFAR noise estimate of the object
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Key, larger for stronger objects
+ *
+ */
+static inline uint16_t CFARCADSP_detBudgetKey
+(
+    uint16_t          peakVal,
+    uint16_t          noiseVal
+)
+{
+    return (peakVal > noiseVal) ? (uint16_t)(peakVal - noiseVal) : 0U;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *     Selects the slot of the detection list for a new detected object when the
+ *     detection budget is enabled. The slots in use are kept in a min-heap keyed
+ *     by @ref CFARCADSP_detBudgetKey. While the budget is not used up the next free
+ *     slot is returned, otherwise the slot of the weakest kept object is returned
+ *     if the new object is stronger than it. The key of the new object is saved
+ *     for the slot.
+ *
+ *  @param[in]    cfarObj           Pointer to CFAR DPU object
+ *  @param[inout] numDetObj         Number of objects in the detection list
+ *  @param[in]    key               Detection budget key of the new object
+ *  @param[out]   detSlot           Index in the detection list for the new object
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      true     - Object is kept, its data must be written to detSlot
+ *  @retval
+ *      false    - Object is dropped
+ */
+static bool CFARCADSP_detBudgetInsert
+(
+    CFARCADspObj      *cfarObj,
+    uint32_t          *numDetObj,
+    uint16_t          key,
+    uint32_t          *detSlot
+)
+{
+    uint16_t         *keys = cfarObj->detObjHeapKeyBuf;
+    uint16_t         *heap = cfarObj->detObjHeapBuf;
+    uint32_t          heapSize = *numDetObj;
+    uint32_t          parent, child;
+    uint16_t          slot;
+
+    if (heapSize < cfarObj->detBudgetLimit)
+    {
+        /* Budget not used up: append and sift up */
+        slot = (uint16_t)heapSize;
+        keys[slot] = key;
+
+        child = heapSize;
+        while (child > 0U)
+        {
+            parent = (child - 1U) >> 1;
+            if (keys[heap[parent]] <= key)
+            {
+                break;
+            }
+            heap[child] = heap[parent];
+            child = parent;
+        }
+        heap[child] = slot;
+        *numDetObj = heapSize + 1U;
+    }
+    else
+    {
+        /* Budget used up: replace the weakest object if the new one is stronger */
+        if (key <= keys[heap[0]])
+        {
+            return false;
+        }
+        slot = heap[0];
+        keys[slot] = key;
+
+        parent = 0U;
+        child = 1U;
+        while (child < heapSize)
+        {
+            if ((child + 1U < heapSize) &&
+                (keys[heap[child + 1U]] < keys[heap[child]]))
+            {
+                child++;
+            }
+            if (key <= keys[heap[child]])
+            {
+                break;
+            }
+            heap[parent] = heap[child];
+            parent = child;
+            child = 2U * parent + 1U;
+        }
+        heap[parent] = slot;
+    }
+
+    *detSlot = slot;
+    return true;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *     Sorts the objects kept by the detection budget back into the order in which
+ *     they were scanned, so that peak grouping and the downstream DPUs see the same
+ *     ordering as without the budget. Shell sort is used since it is in place and
+ *     the number of kept objects is small.
+ *
+ *  @param[in] cfarObj              Pointer to CFAR DPU object
+ *  @param[in] numDetObj            Number of objects in the detection list
+ *  @param[in] peakGrpingEn         Peak grouping enable flag
+ *  @param[in] rangeMajor           true if the list was filled along range lines
+ *                                  (Doppler domain CFAR), false if along Doppler lines
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      None
+ *
+ */
+static void CFARCADSP_detBudgetRestoreScanOrder
+(
+    CFARCADspObj      *cfarObj,
+    uint32_t          numDetObj,
+    uint8_t           peakGrpingEn,
+    bool              rangeMajor
+)
+{
+    DPIF_CFARDetList *detList = cfarObj->res.cfarRngDopSnrList;
+    uint16_t         *rangeIdxBuf;
+    uint16_t         *dopplerIdxBuf;
+    uint32_t          majorStride;
+    uint32_t          gap, i, j;
+
+    if (peakGrpingEn)
+    {
+        rangeIdxBuf = cfarObj->detObjRangeIdxBuf;
+        dopplerIdxBuf = cfarObj->detObjDopplerIdxBuf;
+    }
+    else
+    {
+        /* Indices are taken from the detection list */
+        rangeIdxBuf = NULL;
+        dopplerIdxBuf = NULL;
+    }
+
+    if (rangeMajor)
+    {
+        majorStride = cfarObj->staticCfg.numDopplerBins;
+    }
+    else
+    {
+        majorStride = cfarObj->staticCfg.numRangeBins;
+    }
+
+    for (gap = numDetObj >> 1; gap > 0U; gap >>= 1)
+    {
+        for (i = gap; i < numDetObj; i++)
+        {
+            DPIF_CFARDetList detTmp = detList[i];
+            uint16_t rangeIdx, dopplerIdx, peakVal = 0U;
+            uint32_t key;
+
+            if (peakGrpingEn)
+            {
+                rangeIdx = rangeIdxBuf[i];
+                dopplerIdx = dopplerIdxBuf[i];
+                peakVal = cfarObj->detObjPeakValBuf[i];
+            }
+            else
+            {
+                rangeIdx = detTmp.rangeIdx;
+                dopplerIdx = detTmp.dopplerIdx;
+            }
+
+            if (rangeMajor)
+            {
+                key = rangeIdx * majorStride + dopplerIdx;
+            }
+            else
+            {
+                key = dopplerIdx * majorStride + rangeIdx;
+            }
+
+            for (j = i; j >= gap; j -= gap)
+            {
+                uint32_t keyPrev;
+                uint16_t rangeIdxPrev, dopplerIdxPrev;
+
+                if (peakGrpingEn)
+                {
+                    rangeIdxPrev = rangeIdxBuf[j - gap];
+                    dopplerIdxPrev = dopplerIdxBuf[j - gap];
+                }
+                else
+                {
+                    rangeIdxPrev = detList[j - gap].rangeIdx;
+                    dopplerIdxPrev = detList[j - gap].dopplerIdx;
+                }
+
+                if (rangeMajor)
+                {
+                    keyPrev = rangeIdxPrev * majorStride + dopplerIdxPrev;
+                }
+                else
+                {
+                    keyPrev = dopplerIdxPrev * majorStride + rangeIdxPrev;
+                }
+
+                if (keyPrev <= key)
+                {
+                    break;
+                }
+
+                detList[j] = detList[j - gap];
+                if (peakGrpingEn)
+                {
+                    rangeIdxBuf[j] = rangeIdxPrev;
+                    dopplerIdxBuf[j] = dopplerIdxPrev;
+                    cfarObj->detObjPeakValBuf[j] = cfarObj->detObjPeakValBuf[j - gap];
+                }
+            }
+
+            detList[j] = detTmp;
+            if (peakGrpingEn)
+            {
+                rangeIdxBuf[j] = rangeIdx;
+                dopplerIdxBuf[j] = dopplerIdx;
+                cfarObj->detObjPeakValBuf[j] = peakVal;
+            }
+        }
+    }
+}
+
 /**
  *  @b Description
  *  @n
@@ -741,27 +1048,45 @@ static int32_t CFARCADSP_processDopplerDomain
             }
             else
             {
-                if(peakGrpingEn)
+                float    snrdB;
+                uint32_t detSlot = numDetObjDoppler;
+
+                snrdB = CFARCADSP_CONV_PEAK_TO_LOG((float)currDetMatrixBuffer[dopplerIndex], DPIF_DETMATRIX_DATA_QFORMAT) - noisedB;
+
+                if (cfarObj->detBudgetLimit != 0U)
                 {
-                    cfarObj->detObjRangeIdxBuf[numDetObjDoppler] = rangeIdx;
-                    cfarObj->detObjDopplerIdxBuf[numDetObjDoppler] = dopplerIndex;
-                    cfarObj->detObjPeakValBuf[numDetObjDoppler] = currDetMatrixBuffer[dopplerIndex];
-                    cfarObj->res.cfarRngDopSnrList[numDetObjDoppler].noise = (int16_t)noisedB;
+                    /* Keep only the strongest objects within the detection budget */
+                    if (CFARCADSP_detBudgetInsert(cfarObj, &numDetObjDoppler,
+                                                  CFARCADSP_detBudgetKey(currDetMatrixBuffer[dopplerIndex],
+                                                                         cfarObj->detObjPeakIdxBuf[detIndex]),
+                                                  &detSlot) == false)
+                    {
+                        continue;
+                    }
                 }
                 else
                 {
-                    float snrdB;
-                    snrdB = CFARCADSP_CONV_PEAK_TO_LOG((float)currDetMatrixBuffer[dopplerIndex], DPIF_DETMATRIX_DATA_QFORMAT) - noisedB;
+                    numDetObjDoppler ++;
+                }
 
+                if(peakGrpingEn)
+                {
+                    cfarObj->detObjRangeIdxBuf[detSlot] = rangeIdx;
+                    cfarObj->detObjDopplerIdxBuf[detSlot] = dopplerIndex;
+                    cfarObj->detObjPeakValBuf[detSlot] = currDetMatrixBuffer[dopplerIndex];
+                    cfarObj->res.cfarRngDopSnrList[detSlot].noise = (int16_t)noisedB;
+                }
+                else
+                {
                     /* Update detection list */
-                    cfarObj->res.cfarRngDopSnrList[numDetObjDoppler].rangeIdx = rangeIdx;
-                    cfarObj->res.cfarRngDopSnrList[numDetObjDoppler].dopplerIdx= dopplerIndex;
-                    cfarObj->res.cfarRngDopSnrList[numDetObjDoppler].snr = snrdB;
-                    cfarObj->res.cfarRngDopSnrList[numDetObjDoppler].noise = (int16_t)noisedB;
+                    cfarObj->res.cfarRngDopSnrList[detSlot].rangeIdx = rangeIdx;
+                    cfarObj->res.cfarRngDopSnrList[detSlot].dopplerIdx= dopplerIndex;
+                    cfarObj->res.cfarRngDopSnrList[detSlot].snr = snrdB;
+                    cfarObj->res.cfarRngDopSnrList[detSlot].noise = (int16_t)noisedB;
                 }
 
-                numDetObjDoppler ++;
-                if(numDetObjDoppler >= cfarObj->res.cfarRngDopSnrListSize)
+                if((cfarObj->detBudgetLimit == 0U) &&
+                   (numDetObjDoppler >= cfarObj->res.cfarRngDopSnrListSize))
                 {
                     /* Output is limited by cfarRngDopSnrList size */
                     goto exit;
@@ -879,7 +1204,9 @@ static int32_t CFARCADSP_processRangeDomain
 
         for(detIdx=0; detIdx <numDetObj; detIdx++)
         {
-            if (numDetObjIndex < cfarObj->res.cfarRngDopSnrListSize)
+            /* With the detection budget the list never stops accepting stronger objects */
+            if ((cfarObj->detBudgetLimit != 0U) ||
+                (numDetObjIndex < cfarObj->res.cfarRngDopSnrListSize))
             {
                 uint16_t rangeIdx;
                 uint16_t *cfarDetList = (uint16_t *)cfarObj->res.cfarDetOutBuffer;
@@ -903,29 +1230,43 @@ static int32_t CFARCADSP_processRangeDomain
                    (dopplerSgnIdx <= cfarObj->fovDoppler.maxIdx))
                 {
                     float   noisedB;
+                    float   snrdB;
+                    uint32_t detSlot = numDetObjIndex;
 
-                    /* Calculate noise */
+                    /* Calculate noise and snr */
                     noisedB = CFARCADSP_CONV_PEAK_TO_LOG((float)cfarObj->detObjPeakIdxBuf[detIdx], DPIF_DETMATRIX_DATA_QFORMAT);
-                    if(peakGrpingEn)
+                    snrdB = CFARCADSP_CONV_PEAK_TO_LOG((float)detMat[rangeIdx], DPIF_DETMATRIX_DATA_QFORMAT) - noisedB;
+
+                    if (cfarObj->detBudgetLimit != 0U)
                     {
-                        cfarObj->detObjRangeIdxBuf[numDetObjIndex] = rangeIdx;
-                        cfarObj->detObjDopplerIdxBuf[numDetObjIndex] = dopplerLine;
-                        cfarObj->detObjPeakValBuf[numDetObjIndex] = detMat[rangeIdx];
+                        /* Keep only the strongest objects within the detection budget */
+                        if (CFARCADSP_detBudgetInsert(cfarObj, &numDetObjIndex,
+                                                      CFARCADSP_detBudgetKey(detMat[rangeIdx],
+                                                                             cfarObj->detObjPeakIdxBuf[detIdx]),
+                                                      &detSlot) == false)
+                        {
+                            continue;
+                        }
                     }
                     else
                     {
-                        float   snrdB;
-
-                        snrdB = CFARCADSP_CONV_PEAK_TO_LOG((float)detMat[rangeIdx], DPIF_DETMATRIX_DATA_QFORMAT) - noisedB;
+                        numDetObjIndex++;
+                    }
 
+                    if(peakGrpingEn)
+                    {
+                        cfarObj->detObjRangeIdxBuf[detSlot] = rangeIdx;
+                        cfarObj->detObjDopplerIdxBuf[detSlot] = dopplerLine;
+                        cfarObj->detObjPeakValBuf[detSlot] = detMat[rangeIdx];
+                    }
+                    else
+                    {
                         /* Update detection list */
-                        cfarObj->res.cfarRngDopSnrList[numDetObjIndex].rangeIdx = rangeIdx;
-                        cfarObj->res.cfarRngDopSnrList[numDetObjIndex].dopplerIdx = dopplerLine;
-                        cfarObj->res.cfarRngDopSnrList[numDetObjIndex].snr = (int16_t)snrdB;
+                        cfarObj->res.cfarRngDopSnrList[detSlot].rangeIdx = rangeIdx;
+                        cfarObj->res.cfarRngDopSnrList[detSlot].dopplerIdx = dopplerLine;
+                        cfarObj->res.cfarRngDopSnrList[detSlot].snr = (int16_t)snrdB;
                     }
-                    cfarObj->res.cfarRngDopSnrList[numDetObjIndex].noise = (int16_t)noisedB;
-
-                    numDetObjIndex++;
+                    cfarObj->res.cfarRngDopSnrList[detSlot].noise = (int16_t)noisedB;
                 }
             }
             else
@@ -1130,7 +1471,9 @@ int32_t DPU_CFARCAProcDSP_config
 
     /* The scrach buffer will be used for peak grouping and cfar noise buffer */
     if((pRes->cfarScrachBuffer == NULL) ||
-      (pRes->cfarScrachBufferSize < pRes->cfarRngDopSnrListSize * sizeof(uint16_t) * 4U ))
+      (pRes->cfarScrachBufferSize < pRes->cfarRngDopSnrListSize * sizeof(uint16_t) * 4U ) ||
+      ((cfarcaCfg->dynCfg.detBudget != NULL) && (cfarcaCfg->dynCfg.detBudget->maxNumDetObj != 0U) &&
+       (pRes->cfarScrachBufferSize < pRes->cfarRngDopSnrListSize * sizeof(uint16_t) * 6U )))
     {
         retVal = DPU_CFARCAPROCDSP_ENOMEM__INSUFFICIENT_SCRATCH_BUFFER;
         goto exit;
@@ -1142,8 +1485,30 @@ int32_t DPU_CFARCAProcDSP_config
         cfarDspObj->detObjDopplerIdxBuf = (uint16_t *)((uint32_t)pRes->cfarScrachBuffer + pRes->cfarRngDopSnrListSize * sizeof(uint16_t));
         cfarDspObj->detObjPeakValBuf = (uint16_t *)((uint32_t)cfarDspObj->detObjDopplerIdxBuf + pRes->cfarRngDopSnrListSize * sizeof(uint16_t));
         cfarDspObj->detObjPeakIdxBuf = (uint16_t *)((uint32_t)cfarDspObj->detObjPeakValBuf + pRes->cfarRngDopSnrListSize * sizeof(uint16_t));
+
+        /* Detection budget heap and keys, only if the scratch buffer is large enough */
+        if (pRes->cfarScrachBufferSize >= pRes->cfarRngDopSnrListSize * sizeof(uint16_t) * 6U)
+        {
+            cfarDspObj->detObjHeapBuf = (uint16_t *)((uint32_t)cfarDspObj->detObjPeakIdxBuf + pRes->cfarRngDopSnrListSize * sizeof(uint16_t));
+            cfarDspObj->detObjHeapKeyBuf = (uint16_t *)((uint32_t)cfarDspObj->detObjHeapBuf + pRes->cfarRngDopSnrListSize * sizeof(uint16_t));
+        }
+        else
+        {
+            cfarDspObj->detObjHeapBuf = NULL;
+            cfarDspObj->detObjHeapKeyBuf = NULL;
+        }
     }
 
+    if (cfarcaCfg->dynCfg.detBudget != NULL)
+    {
+        cfarDspObj->detBudget = *cfarcaCfg->dynCfg.detBudget;
+    }
+    else
+    {
+        cfarDspObj->detBudget.maxNumDetObj = 0U;
+    }
+    CFARCADSP_setDetBudget(cfarDspObj);
+
 exit:
     return retVal;
 }
@@ -1223,6 +1588,15 @@ int32_t DPU_CFARCAProcDSP_process
         numObjs = pRes->cfarRngDopSnrListSize;
     }
 
+    /* Objects kept by the detection budget are in heap order, put them back in scan order */
+    if ((cfarDspObj->detBudgetLimit != 0U) && (numObjs > 1U))
+    {
+        CFARCADSP_detBudgetRestoreScanOrder(cfarDspObj,
+                                            numObjs,
+                                            peakGrpingEn,
+                                            (cfarDspObj->cfarCfgRange.thresholdScale == 0));
+    }
+
     /* CFARCA peak Grouping */
     if ( (cfarDspObj->cfarCfgRange.peakGroupingEn) || (cfarDspObj->cfarCfgDoppler.peakGroupingEn))
     {
@@ -1362,6 +1736,29 @@ int32_t DPU_CFARCAProcDSP_control
             }
         }
         break;
+        case DPU_CFARCAProcDSP_Cmd_DetBudgetCfg:
+        {
+            DPU_CFARCAProc_DetBudgetCfg *detBudgetCfg = arg;
+            if((argSize != sizeof(DPU_CFARCAProc_DetBudgetCfg)) ||
+               (arg == NULL))
+            {
+                retVal = DPU_CFARCAPROCDSP_EINVAL;
+                goto exit;
+            }
+            else if ((detBudgetCfg->maxNumDetObj != 0U) &&
+                     (cfarDspObj->detObjHeapBuf == NULL))
+            {
+                retVal = DPU_CFARCAPROCDSP_ENOMEM__INSUFFICIENT_SCRATCH_BUFFER;
+                goto exit;
+            }
+            else
+            {
+                /* Save configuration, applies from the next processing call */
+                cfarDspObj->detBudget = *detBudgetCfg;
+                CFARCADSP_setDetBudget(cfarDspObj);
+            }
+        }
+        break;
 
         default:
             retVal = DPU_CFARCAPROCDSP_EINVAL;
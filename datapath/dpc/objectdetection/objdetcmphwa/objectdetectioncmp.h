@@ -452,6 +452,11 @@ typedef struct DPC_ObjectDetectionCmp_DPC_IOCTL_preStartCfg_memUsage_t
      *           amount indicated through @ref DPC_ObjectDetectionCmp_InitParams */
     uint32_t CoreLocalRamUsage;
 
+    /*! @brief   Indicates number of bytes of Core Local memory saved by overlaying the scratch
+     *           buffers of the DPUs, i.e. how much larger CoreLocalRamUsage would be if
+     *           every DPU had its own scratch */
+    uint32_t CoreLocalRamScratchSaving;
+
     /*! @brief   Indicates number of bytes of system heap allocated */
     uint32_t SystemHeapTotal;
 
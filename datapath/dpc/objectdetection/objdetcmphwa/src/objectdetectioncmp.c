@@ -284,6 +284,25 @@ static uint32_t DPC_ObjDetCmp_MemPoolGetMaxUsage(MemPoolObj *pool)
     return((uint32_t)(pool->maxCurrAddr - (uintptr_t)pool->cfg.addr));
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Utility function for getting the amount of memory allocated from the pool
+ *      since the pool was at the given address (see @ref DPC_ObjDetCmp_MemPoolGet).
+ *
+ *  @param[in]  pool Handle to pool object.
+ *  @param[in]  addr Earlier current address of the pool.
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Amount of pool allocated since addr in bytes.
+ */
+static uint32_t DPC_ObjDetCmp_MemPoolGetUsageSince(MemPoolObj *pool, void *addr)
+{
+    return((uint32_t)(pool->currAddr - (uintptr_t)addr));
+}
+
 /**
  *  @b Description
  *  @n
@@ -2029,6 +2048,8 @@ exit:
  *              by the DPUs.
  *  @param[out] CoreLocalRamUsage Net Core Local RAM memory usage in bytes as a
  *              result of allocation by the DPUs.
+ *  @param[out] CoreLocalRamScratchSaving Core Local RAM bytes saved by overlaying
+ *              the scratch buffers of the DPUs.
  *
  *  @retval
  *      Success -   0
@@ -2047,7 +2068,8 @@ static int32_t DPC_ObjDetCmp_preStartConfig(SubFrameObj *obj,
                    uint32_t                      hwaMemBankAddr[4],
                    uint16_t                      hwaMemBankSize,
                    uint32_t                      *L3RamUsage,
-                   uint32_t                      *CoreLocalRamUsage)
+                   uint32_t                      *CoreLocalRamUsage,
+                   uint32_t                      *CoreLocalRamScratchSaving)
 {
     int32_t retVal = 0;
     DPIF_RadarCube radarCube;
@@ -2058,6 +2080,7 @@ static int32_t DPC_ObjDetCmp_preStartConfig(SubFrameObj *obj,
     DPIF_CFARDetList *cfarRngDopSnrList;
     uint32_t cfarRngDopSnrListSize;
     void *CoreLocalScratchStartPoolAddr;
+    uint32_t CoreLocalScratchSum = 0U;
 
     /* save configs to object. We need to pass this stored config (instead of
        the input arguments to this function which will be in stack) to
@@ -2129,6 +2152,8 @@ static int32_t DPC_ObjDetCmp_preStartConfig(SubFrameObj *obj,
         goto exit;
     }
 
+    CoreLocalScratchSum += DPC_ObjDetCmp_MemPoolGetUsageSince(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
+
     /* Rewind to the scratch beginning */
     DPC_ObjDetCmp_MemPoolSet(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
 
@@ -2151,6 +2176,8 @@ static int32_t DPC_ObjDetCmp_preStartConfig(SubFrameObj *obj,
         goto exit;
     }
 
+    CoreLocalScratchSum += DPC_ObjDetCmp_MemPoolGetUsageSince(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
+
     /* Rewind to the scratch beginning */
     DPC_ObjDetCmp_MemPoolSet(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
 
@@ -2198,10 +2225,19 @@ static int32_t DPC_ObjDetCmp_preStartConfig(SubFrameObj *obj,
         goto exit;
     }
 
+    CoreLocalScratchSum += DPC_ObjDetCmp_MemPoolGetUsageSince(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
+
     /* Report RAM usage */
     *CoreLocalRamUsage = DPC_ObjDetCmp_MemPoolGetMaxUsage(CoreLocalRamObj);
     *L3RamUsage = DPC_ObjDetCmp_MemPoolGetMaxUsage(L3ramObj);
 
+    /* Each DPU's scratch starts at the same pool position, because the DPUs never run at
+     * the same time (doppler and AoA are counted together as AoA uses the doppler window).
+     * Without this overlay, the pool would need the persistent part plus the sum of all
+     * DPU footprints. */
+    *CoreLocalRamScratchSaving = (uint32_t)((uintptr_t)CoreLocalScratchStartPoolAddr - (uintptr_t)CoreLocalRamObj->cfg.addr) +
+                                 CoreLocalScratchSum - *CoreLocalRamUsage;
+
 exit:
     return retVal;
 }
@@ -2641,7 +2677,8 @@ static int32_t DPC_ObjectDetectionCmp_ioctl
                              &objDetCmpObj->hwaMemBankAddr[0],
                              objDetCmpObj->hwaMemBankSize,
                              &memUsage->L3RamUsage,
-                             &memUsage->CoreLocalRamUsage);
+                             &memUsage->CoreLocalRamUsage,
+                             &memUsage->CoreLocalRamScratchSaving);
                 if (retVal != 0)
                 {
 					
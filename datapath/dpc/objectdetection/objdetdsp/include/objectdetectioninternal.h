@@ -154,6 +154,39 @@ typedef struct MemPoolObj_t
     uintptr_t maxCurrAddr;
 } MemPoolObj;
 
+/*
+ * @brief Record of the last window generated into a DPU window buffer during sub-frame
+ *        reconfiguration, see @ref DPC_ObjDetDSP_isWindowGenRequired.
+ */
+typedef struct WindowGenTag_t
+{
+    /*! @brief  Window buffer, NULL if no window is known to be in place */
+    void        *win;
+
+    /*! @brief  Nominal window length, the window type and format follow from it */
+    uint32_t    winLen;
+} WindowGenTag;
+
+/*
+ * @brief Running sums of the range bias and rx channel measurement over the frames
+ *        averaged so far, see @ref DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure.
+ */
+typedef struct RxChanBiasMeasureAcc_t
+{
+    /*! @brief  Sum of the per frame range bias estimates (in meters) */
+    float       rangeBiasSum;
+
+    /*! @brief  Sum of the virtual antenna symbols (real part), indexed in the
+     *          order of @ref DPU_AoAProc_compRxChannelBiasCfg_t::rxChPhaseComp */
+    float       symSumReal[SYS_COMMON_NUM_TX_ANTENNAS * SYS_COMMON_NUM_RX_CHANNEL];
+
+    /*! @brief  Sum of the virtual antenna symbols (imaginary part) */
+    float       symSumImag[SYS_COMMON_NUM_TX_ANTENNAS * SYS_COMMON_NUM_RX_CHANNEL];
+
+    /*! @brief  Number of frames accumulated in the sums */
+    uint16_t    numFrames;
+} RxChanBiasMeasureAcc;
+
 /**
  * @brief
  *  Millimeter Object Detection DPC object/instance
@@ -219,11 +252,21 @@ typedef struct ObjDetObj_t
      *           but not use it in the re-configuration of AoA during process */
     DPU_AoAProc_compRxChannelBiasCfg compRxChanCfgMeasureOut;
 
+    /*! @brief   Range Bias and rx channel measurement accumulated over frames
+     *           until @ref compRxChanCfgMeasureOut is next updated */
+    RxChanBiasMeasureAcc rxChanBiasMeasureAcc;
+
     /*! @brief   Stats structure to convey to Application timing and related information. */
     DPC_ObjectDetection_Stats stats;
 
     /*! @brief   Process call back function configuration */
     DPC_ObjectDetection_ProcessCallBackCfg processCallBackCfg;
+
+    /*! @brief   Last range window generated in sub-frame reconfiguration */
+    WindowGenTag rangeWindowTag;
+
+    /*! @brief   Last doppler window generated in sub-frame reconfiguration */
+    WindowGenTag dopplerWindowTag;
 } ObjDetObj;
 
 /**
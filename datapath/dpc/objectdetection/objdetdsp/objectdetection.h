@@ -104,7 +104,19 @@
  *        @verbatim --define=OBJDET_NO_RANGE @endverbatim
  *        DPC accepts frameStart and data injection(trigger DPC execution) from DPM. All doppler DPU, cfarca DPU and AoA DPU will be
  *        executed during DPC execution(@ref DPC_ObjectDetection_execute).
- *   
+ *
+ *  @subsection objdetdsp_pipelining Frame pipelining
+ *   With the second option, range processing of frame N+1 (done by another core, e.g. the objdetrangehwa
+ *   DPC on the R4F) overlaps with the inter-frame processing of frame N in this DPC. The overlap is bounded
+ *   by the single radar cube given through @ref DPC_ObjectDetection_ShareMemCfg_t::radarCubeMem: frame N
+ *   must be done with the cube before the first chirp of frame N+1 is written to it.
+ *   The DPUs are driven in a fixed order on buffers allocated at
+ *   @ref DPC_OBJDET_IOCTL__STATIC_PRE_START_CFG time:
+ *   radar cube -> Doppler -> detection matrix -> CFAR -> CFAR list -> AoA -> results.
+ *   To run the stages on different frames at the same time, each frame in flight needs its own radar cube,
+ *   detection matrix and CFAR list, and its own AoA outputs (point cloud and range-azimuth heatmap).
+ *   Under those conditions, the results are the same as with serial execution.
+ *
  *  @section objdetdsp_memory Data Memory
  *
  *  @subsection objdetdsp_memCfg Memory configuration
@@ -148,6 +160,15 @@
  *   buffers). This arrangement in memory makes the 2D window/twiddle sharable between Doppler and AoA DPUs.
  *   It also prevents window/twiddle buffer re-generation across frame boundary in non-advanced
  *   frame scenarios.
+ *   When the number of doppler bins equals the number of angle bins (@ref DPU_AOAPROCDSP_NUM_ANGLE_BINS),
+ *   the AoA angle FFT twiddle table is identical to the 2D twiddle table. A single table is then allocated
+ *   in L1 instead of L2, and it is used as the 2D "twiddle Buffer" and as the AoA angle twiddle buffer.
+ *
+ *   The AoA scratch in L2 also holds the range bin grouping buffers of the AoA DPU
+ *   (@ref DPU_AoAProcDSP_HW_Resources_t::dopplerFftRowBuf, numTxAntennas * numRxAntennas * numDopplerBins
+ *   * sizeof(cmplx32ReIm_t) bytes, i.e 12 KB to 24 KB for 3 Tx, 4 Rx and 128 to 256 Doppler bins, and
+ *   @ref DPU_AoAProcDSP_HW_Resources_t::rangeGroupIdxBuf). They are allocated only if they fit in the
+ *   L2 left after the other AoA buffers, otherwise the AoA DPU fetches the radar cube per object.
  *
  *   The AoA DPU API has been designed to require 2D-FFT window and twiddle buffer configuration
  *   (i.e configuration is not optional) because it may be used in contexts (unit test, other DPC flavors) where doppler 
@@ -261,6 +282,19 @@
  *     to the application as part of the result structure produced by DPC's execute
  *     API (@ref DPC_ObjectDetection_ExecuteResult_t::compRxChanBiasMeasurement).
  *
+ *     When @ref DPC_ObjectDetection_MeasureRxChannelBiasCfg_t::numAvgFrames is
+ *     greater than 1, the range bias and the symbols \f$x(i_{Tx},i_{Rx})\f$ are averaged
+ *     over that many frames before the coefficients are computed, and the result is
+ *     given out only in the frame that completes the average. Before summing, each
+ *     frame's symbols are rotated by the conjugate phase of the first virtual antenna
+ *     so that the target phase, which changes from frame to frame with the smallest
+ *     motion of the reflector, does not cancel the sum. This leaves the relative
+ *     phases, which are what the coefficients compensate, unchanged. The averaging
+ *     still needs the reflector at boresight: a target at an unknown angle adds
+ *     a phase progression across the array that cannot be told apart from
+ *     the channel phase offsets, so the measurement cannot be run from arbitrary
+ *     detections of the scene. Changing the measurement configuration restarts the average.
+ *
  *   @subsection objdetdsp_compensation Compensation
  *     When compensation configuration (DPU_AoAProc_compRxChannelBiasCfg_t) is provided as part of
  *     pre-start common config (@ref DPC_ObjectDetection_PreStartCommonCfg_t::compRxChanCfg) or
@@ -410,6 +444,18 @@ typedef struct DPC_ObjectDetection_fovDopplerCfg_t
    DPU_CFARCAProc_FovCfg cfg;
 } DPC_ObjectDetection_fovDopplerCfg;
 
+/*! @brief      CFAR detection budget configuration */
+typedef struct DPC_ObjectDetection_CfarDetBudgetCfg_t
+{
+    /*! @brief   Subframe number for which this message is applicable. When
+     *           advanced frame is not used, this should be set to
+     *           0 (the 1st and only sub-frame) */
+   uint8_t subFrameNum;
+
+   /*! @brief      CFAR detection budget configuration */
+   DPU_CFARCAProc_DetBudgetCfg cfg;
+} DPC_ObjectDetection_CfarDetBudgetCfg;
+
 /**
  * @brief
  *  Multi-object beam forming Configuration.
@@ -516,6 +562,10 @@ typedef struct DPC_ObjectDetection_MeasureRxChannelBiasCfg_t
     /*! @brief  Search window size (in meters), the search is done in range
      *          [-searchWinSize/2 + targetDistance, targetDistance + searchWinSize/2] */
     float searchWinSize;
+
+    /*! @brief  Number of frames averaged per measurement result. 0 or 1 gives a new
+     *          single frame result every frame, see @ref objdetdsp_measurement */
+    uint16_t numAvgFrames;
 } DPC_ObjectDetection_MeasureRxChannelBiasCfg;
 
 /*!
@@ -669,6 +719,9 @@ typedef struct DPC_ObjectDetection_DynCfg_t
     /*! @brief      Field of view configuration in Doppler domain */
     DPU_CFARCAProc_FovCfg fovDoppler;
 
+    /*! @brief      CFAR detection budget configuration */
+    DPU_CFARCAProc_DetBudgetCfg cfarDetBudget;
+
     /*! @brief   Multi Object Beam Forming configuration */
     DPU_AoAProc_MultiObjBeamFormingCfg multiObjBeamFormingCfg;
 
@@ -751,6 +804,16 @@ typedef struct DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage_t
      *           amount indicated through @ref DPC_ObjectDetection_InitParams */
     uint32_t CoreL1RamUsage;
 
+    /*! @brief   Indicates number of bytes of Core L2 memory saved by overlaying the scratch
+     *           buffers of the DPUs, i.e. how much larger CoreL2RamUsage would be if
+     *           every DPU had its own scratch */
+    uint32_t CoreL2RamScratchSaving;
+
+    /*! @brief   Indicates number of bytes of Core L1 memory saved by overlaying the scratch
+     *           buffers of the DPUs, i.e. how much larger CoreL1RamUsage would be if
+     *           every DPU had its own scratch */
+    uint32_t CoreL1RamScratchSaving;
+
     /*! @brief   Indicates number of bytes of system heap allocated */
     uint32_t SystemHeapTotal;
 
@@ -866,7 +929,10 @@ typedef struct DPC_ObjectDetection_ExecuteResult_t
      *           expected that when measurement is enabled,
      *           the number of sub-frames will be 1 (i.e advanced frame
      *           feature will be disabled). If measurement
-     *           was not enabled, then this pointer will be NULL. */
+     *           was not enabled, or if it is averaging over frames
+     *           (@ref DPC_ObjectDetection_MeasureRxChannelBiasCfg_t::numAvgFrames)
+     *           and the average is not complete in this frame,
+     *           then this pointer will be NULL. */
     DPU_AoAProc_compRxChannelBiasCfg *compRxChanBiasMeasurement;
 } DPC_ObjectDetection_ExecuteResult;
 
@@ -1014,11 +1080,18 @@ typedef struct DPC_ObjectDetection_ExecuteResultExportedInfo_t
  */
 #define DPC_OBJDET_IOCTL__TRIGGER_CHIRP                                     (DPM_CMD_DPC_START_INDEX + 16U)
 
+/**
+ * @brief Command associated with @ref DPC_ObjectDetection_CfarDetBudgetCfg_t.
+ *        The budget scratch is reserved only if the budget is enabled in the
+ *        pre-start configuration of the sub-frame, enabling it otherwise fails.
+ */
+#define DPC_OBJDET_IOCTL__DYNAMIC_CFAR_DET_BUDGET                           (DPM_CMD_DPC_START_INDEX + 17U)
+
 /**
  * @brief This is not a command, just to capture the last command supported in DPC.
         This definition is used to track if the commond is targed for this DPC, otherwise return an error.
  */
-#define DPC_OBJDET_IOCTL__MAX                                               (DPC_OBJDET_IOCTL__TRIGGER_CHIRP)
+#define DPC_OBJDET_IOCTL__MAX                                               (DPC_OBJDET_IOCTL__DYNAMIC_CFAR_DET_BUDGET)
 
 /**
 @}
@@ -293,6 +293,25 @@ static uint32_t DPC_ObjDetDSP_MemPoolGetMaxUsage(MemPoolObj *pool)
     return((uint32_t)(pool->maxCurrAddr - (uintptr_t)pool->cfg.addr));
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Utility function for getting the amount of memory allocated from the pool
+ *      since the pool was at the given address (see @ref DPC_ObjDetDSP_MemPoolGet).
+ *
+ *  @param[in]  pool Handle to pool object.
+ *  @param[in]  addr Earlier current address of the pool.
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Amount of pool allocated since addr in bytes.
+ */
+static uint32_t DPC_ObjDetDSP_MemPoolGetUsageSince(MemPoolObj *pool, void *addr)
+{
+    return((uint32_t)(pool->currAddr - (uintptr_t)addr));
+}
+
 /**
  *  @b Description
  *  @n
@@ -694,19 +713,24 @@ static void DPC_ObjDetDSP_quadFit(float *x, float*y, float *xv, float *yv)
  *  @param[in]  searchWinSize Search window size in meters
  *  @param[in] detMatrix Pointer to detection matrix
  *  @param[in] symbolMatrix Pointer to symbol matrix
- *  @param[out] compRxChanCfg computed output range bias and rx phase comp vector
+ *  @param[in] numAvgFrames Number of frames to average, 0 or 1 for no averaging
+ *  @param[in,out] acc Sums of the measurement over the frames averaged so far
+ *  @param[out] compRxChanCfg computed output range bias and rx phase comp vector,
+ *                            only written when the average is complete
  *
- *  @retval   None
+ *  @retval   true if compRxChanCfg was updated in this call, false otherwise
  *
  * \ingroup DPC_OBJDET__INTERNAL_FUNCTION
  */
-static void DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure
+static bool DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure
 (
     DPC_ObjectDetection_StaticCfg       *staticCfg,
     float                   targetDistance,
     float                   searchWinSize,
     uint16_t                *detMatrix,
     uint32_t                *symbolMatrix,
+    uint16_t                numAvgFrames,
+    RxChanBiasMeasureAcc    *acc,
     DPU_AoAProc_compRxChannelBiasCfg *compRxChanCfg
 )
 {
@@ -718,6 +742,8 @@ static void DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure
     int32_t iMax;
     float xMagSqMin;
     float scal;
+    float refReal, refImag;
+    float xReal, xImag;
     float truePosition;
     int32_t truePositionIndex;
     float y[3];
@@ -777,9 +803,9 @@ static void DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure
         ind++;
     }
     DPC_ObjDetDSP_quadFit(x, y, &estPeakPos, &estPeakVal);
-    compRxChanCfg->rangeBias = (estPeakPos - truePosition) * staticCfg->rangeStep;
+    acc->rangeBiasSum += (estPeakPos - truePosition) * staticCfg->rangeStep;
 
-    /*** Calculate Rx channel phase/gain compensation coefficients ***/
+    /*** Accumulate the virtual antenna symbols at the peak ***/
     for (txIdx = 0; txIdx < numTxAntennas; txIdx++)
     {
         for (rxIdx = 0; rxIdx < numRxAntennas; rxIdx++)
@@ -787,8 +813,58 @@ static void DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure
             i = txIdx * numRxAntennas + rxIdx;
             symbolMatrixIndx = txIdx * numSymPerTxAnt + rxIdx * numRangeBins + iMax;
             rxSymPtr[i] = symbolMatrix[symbolMatrixIndx];
-            xMagSq[i] = (float) rxSym[i].real * (float) rxSym[i].real +
-                        (float) rxSym[i].imag * (float) rxSym[i].imag;
+        }
+    }
+
+    /* When averaging, rotate all symbols by the conjugate phase of the first virtual
+     * antenna so the frame to frame target phase does not cancel the sum */
+    refReal = 1.0f;
+    refImag = 0.0f;
+    if (numAvgFrames > 1)
+    {
+        sumSqr = (float) rxSym[0].real * (float) rxSym[0].real +
+                 (float) rxSym[0].imag * (float) rxSym[0].imag;
+        if (sumSqr > 0.0f)
+        {
+#ifdef SUBSYS_DSS
+            scal = 1.0f / sqrtsp(sumSqr);
+#else
+            scal = 1.0f / sqrt(sumSqr);
+#endif
+            refReal = (float) rxSym[0].real * scal;
+            refImag = (float) rxSym[0].imag * scal;
+        }
+    }
+
+    for (txIdx = 0; txIdx < numTxAntennas; txIdx++)
+    {
+        for (rxIdx = 0; rxIdx < numRxAntennas; rxIdx++)
+        {
+            i = txIdx * numRxAntennas + rxIdx;
+            ind = staticCfg->txAntOrder[txIdx] * numRxAntennas + rxIdx;
+            acc->symSumReal[ind] += (float) rxSym[i].real * refReal + (float) rxSym[i].imag * refImag;
+            acc->symSumImag[ind] += (float) rxSym[i].imag * refReal - (float) rxSym[i].real * refImag;
+        }
+    }
+    acc->numFrames++;
+
+    if (acc->numFrames < numAvgFrames)
+    {
+        return false;
+    }
+
+    compRxChanCfg->rangeBias = acc->rangeBiasSum / acc->numFrames;
+
+    /*** Calculate Rx channel phase/gain compensation coefficients ***/
+    for (txIdx = 0; txIdx < numTxAntennas; txIdx++)
+    {
+        for (rxIdx = 0; rxIdx < numRxAntennas; rxIdx++)
+        {
+            i = txIdx * numRxAntennas + rxIdx;
+            ind = staticCfg->txAntOrder[txIdx] * numRxAntennas + rxIdx;
+            xReal = acc->symSumReal[ind] / acc->numFrames;
+            xImag = acc->symSumImag[ind] / acc->numFrames;
+            xMagSq[i] = xReal * xReal + xImag * xImag;
         }
     }
     xMagSqMin = xMagSq[0];
@@ -806,19 +882,23 @@ static void DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure
         {
             int32_t temp;
             i = txIdx * numRxAntennas + rxIdx;
+            ind = staticCfg->txAntOrder[txIdx] * numRxAntennas + rxIdx;
+            xReal = acc->symSumReal[ind] / acc->numFrames;
+            xImag = acc->symSumImag[ind] / acc->numFrames;
             scal = 32768./ xMagSq[i] * sqrt(xMagSqMin);
 
-            temp = (int32_t) MATHUTILS_ROUND_FLOAT(scal * rxSym[i].real);
+            temp = (int32_t) MATHUTILS_ROUND_FLOAT(scal * xReal);
             MATHUTILS_SATURATE16(temp);
-            compRxChanCfg->rxChPhaseComp[staticCfg->txAntOrder[txIdx] * numRxAntennas +
-                                         rxIdx].real = (int16_t) (temp);
+            compRxChanCfg->rxChPhaseComp[ind].real = (int16_t) (temp);
 
-            temp = (int32_t) MATHUTILS_ROUND_FLOAT(-scal * rxSym[i].imag);
+            temp = (int32_t) MATHUTILS_ROUND_FLOAT(-scal * xImag);
             MATHUTILS_SATURATE16(temp);
-            compRxChanCfg->rxChPhaseComp[staticCfg->txAntOrder[txIdx] * numRxAntennas
-                                         + rxIdx].imag = (int16_t) (temp);
+            compRxChanCfg->rxChPhaseComp[ind].imag = (int16_t) (temp);
         }
     }
+
+    memset((void *)acc, 0, sizeof(RxChanBiasMeasureAcc));
+    return true;
 }
 
 /**
@@ -925,6 +1005,41 @@ static void DPC_ObjDetDSP_GetRxChPhaseComp(DPC_ObjectDetection_StaticCfg *static
     }
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Checks whether a window needs to be generated in sub-frame reconfiguration, and
+ *      records it as the last window generated into its buffer. A window of the same length
+ *      that was the last one generated into the same buffer is still in place: nothing else
+ *      writes into window buffers, and the scratch buffers of the sub-frame that generated it
+ *      do not overlap it.
+ *
+ *  @param[in]  tag     Record of the last window generated for this kind of window
+ *  @param[in]  win     Window buffer of the sub-frame
+ *  @param[in]  winLen  Nominal window length of the sub-frame
+ *
+ *  @retval
+ *      true if the window needs to be generated.
+ *
+ * \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ */
+static bool DPC_ObjDetDSP_isWindowGenRequired(WindowGenTag *tag, void *win, uint32_t winLen)
+{
+    bool genRequired = true;
+
+    if ((tag->win == win) && (tag->winLen == winLen))
+    {
+        genRequired = false;
+    }
+    else
+    {
+        tag->win = win;
+        tag->winLen = winLen;
+    }
+
+    return(genRequired);
+}
+
 /**
  *  @b Description
  *  @n
@@ -951,8 +1066,13 @@ static int32_t DPC_ObjDetDSP_reconfigSubFrame(ObjDetObj *objDetObj, uint8_t subF
     subFrmObj = &objDetObj->subFrameObj[subFrameIndx];
 
 #ifndef OBJDET_NO_RANGE
-    /* Generate windowing buffer */
-    DPC_ObjDetDSP_GenRangeWindow(&subFrmObj->dpuCfg.rangeCfg);
+    /* Generate windowing buffer, unless the same window is still in place */
+    if (DPC_ObjDetDSP_isWindowGenRequired(&objDetObj->rangeWindowTag,
+            subFrmObj->dpuCfg.rangeCfg.hwRes.window,
+            subFrmObj->dpuCfg.rangeCfg.staticCfg.ADCBufData.dataProperty.numAdcSamples) == true)
+    {
+        DPC_ObjDetDSP_GenRangeWindow(&subFrmObj->dpuCfg.rangeCfg);
+    }
     retVal = DPU_RangeProcDSP_config(subFrmObj->dpuRangeObj, &subFrmObj->dpuCfg.rangeCfg);
     if (retVal != 0)
     {
@@ -966,8 +1086,13 @@ static int32_t DPC_ObjDetDSP_reconfigSubFrame(ObjDetObj *objDetObj, uint8_t subF
         goto exit;
     }
 
-    /* Generate 2D window coefficients.*/
-    DPC_ObjDetDSP_GenDopplerWindow(&subFrmObj->dpuCfg.dopplerCfg);
+    /* Generate 2D window coefficients, unless the same window is still in place */
+    if (DPC_ObjDetDSP_isWindowGenRequired(&objDetObj->dopplerWindowTag,
+            subFrmObj->dpuCfg.dopplerCfg.hwRes.windowCoeff,
+            subFrmObj->dpuCfg.dopplerCfg.staticCfg.numDopplerChirps) == true)
+    {
+        DPC_ObjDetDSP_GenDopplerWindow(&subFrmObj->dpuCfg.dopplerCfg);
+    }
     retVal = DPU_DopplerProcDSP_config(subFrmObj->dpuDopplerObj, &subFrmObj->dpuCfg.dopplerCfg);
     if (retVal != 0)
     {
@@ -1140,6 +1265,9 @@ static int32_t DPC_ObjDetDSP_Config_MeasureRxChannelBiasCfg(ObjDetObj *obj,
     }
     obj->commonCfg.measureRxChannelBiasCfg = *cfg;
 
+    /* Restart the average with the new configuration */
+    memset((void *)&obj->rxChanBiasMeasureAcc, 0, sizeof(RxChanBiasMeasureAcc));
+
 exit:
     return retVal;
 }
@@ -1382,6 +1510,7 @@ static int32_t DPC_ObjDetDSP_CFARCAconfig
     cfarCfg.dynCfg.fovRange       = &dynCfg->fovRange;
     cfarCfg.dynCfg.cfarCfgDoppler = &dynCfg->cfarCfgDoppler;
     cfarCfg.dynCfg.cfarCfgRange   = &dynCfg->cfarCfgRange;
+    cfarCfg.dynCfg.detBudget      = &dynCfg->cfarDetBudget;
 
     /* Although CFARCA sopports both schemes, in DPC we fixed into one scheme */
     cfarCfg.dynCfg.cfarCfgDoppler->peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
@@ -1428,8 +1557,16 @@ static int32_t DPC_ObjDetDSP_CFARCAconfig
                                                                DPU_CFARCAPROCDSP_CFAR_DETOUT_BYTE_ALIGNMENT);
     DebugP_assert(hwRes->cfarDetOutBuffer != NULL);
 
-    /* Scratch buffers for CFAR. */
-    hwRes->cfarScrachBufferSize = DPC_OBJDET_MAX_NUM_OBJECTS * sizeof(uint16_t) * 4;
+    /* Scratch buffers for CFAR, the detection budget heap and keys are reserved only
+     * if the budget is enabled at pre-start. */
+    if (dynCfg->cfarDetBudget.maxNumDetObj != 0U)
+    {
+        hwRes->cfarScrachBufferSize = DPC_OBJDET_MAX_NUM_OBJECTS * sizeof(uint16_t) * 6;
+    }
+    else
+    {
+        hwRes->cfarScrachBufferSize = DPC_OBJDET_MAX_NUM_OBJECTS * sizeof(uint16_t) * 4;
+    }
     hwRes->cfarScrachBuffer = (uint16_t *) DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
                                                                hwRes->cfarScrachBufferSize,
                                                                DPU_CFARCAPROCDSP_SCRACHBUF_BYTE_ALIGNMENT);
@@ -1530,6 +1667,8 @@ static int32_t DPC_ObjDetDSP_AoAconfig
     DPU_AoAProcDSP_Config aoaCfg;
     DPU_AoAProcDSP_HW_Resources *res;
     DPU_AoAProc_compRxChannelBiasCfg outCompRxCfg;
+    void *poolAddr;
+    uintptr_t poolMaxAddr;
 
     res = &aoaCfg.res;
     memset(&aoaCfg, 0, sizeof(aoaCfg));
@@ -1637,6 +1776,31 @@ static int32_t DPC_ObjDetDSP_AoAconfig
                                                   DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
     DebugP_assert(res->pingPongBuf != NULL);
 
+    /* Range bin grouping buffers, optional: if they do not fit in what is left of the
+     * L2 pool the AoA DPU processes the objects one by one */
+    poolAddr    = DPC_ObjDetDSP_MemPoolGet(CoreL2RamObj);
+    poolMaxAddr = CoreL2RamObj->maxCurrAddr;
+    res->rangeGroupIdxSize = sizeof(uint16_t) * res->detObjOutMaxSize;
+    res->rangeGroupIdxBuf  = (uint16_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                  res->rangeGroupIdxSize,
+                                                  DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+
+    res->dopplerFftRowSize = sizeof(cmplx32ReIm_t) * staticCfg->numTxAntennas *
+                             staticCfg->ADCBufData.dataProperty.numRxAntennas * staticCfg->numDopplerBins;
+    res->dopplerFftRowBuf  = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                  res->dopplerFftRowSize,
+                                                  DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+
+    if ((res->rangeGroupIdxBuf == NULL) || (res->dopplerFftRowBuf == NULL))
+    {
+        DPC_ObjDetDSP_MemPoolSet(CoreL2RamObj, poolAddr);
+        CoreL2RamObj->maxCurrAddr = poolMaxAddr;
+        res->rangeGroupIdxBuf  = NULL;
+        res->rangeGroupIdxSize = 0U;
+        res->dopplerFftRowBuf  = NULL;
+        res->dopplerFftRowSize = 0U;
+    }
+
     /* Coeff buffers */
     res->windowCoeff       = window;
     res->windowSize        = windowSize;
@@ -1702,6 +1866,8 @@ exit:
  *                              by the DPUs.
  *  @param[out] CoreL2RamUsage  Net Local L2 RAM memory usage in bytes
  *  @param[out] CoreL1RamUsage  Net Core L1 RAM memory usage in bytes
+ *  @param[out] CoreL2RamScratchSaving  Local L2 RAM bytes saved by overlaying the DPU scratch buffers
+ *  @param[out] CoreL1RamScratchSaving  Core L1 RAM bytes saved by overlaying the DPU scratch buffers
  *
  *  @retval
  *      Success -   0
@@ -1721,7 +1887,9 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     MemPoolObj                     *CoreL1RamObj,
     uint32_t                       *L3RamUsage,
     uint32_t                       *CoreL2RamUsage,
-    uint32_t                       *CoreL1RamUsage
+    uint32_t                       *CoreL1RamUsage,
+    uint32_t                       *CoreL2RamScratchSaving,
+    uint32_t                       *CoreL1RamScratchSaving
 )
 {
     int32_t retVal = 0;
@@ -1739,6 +1907,8 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     uint32_t cfarRngDopSnrListSize;
     void *CoreL2ScratchStartPoolAddr;
     void *CoreL1ScratchStartPoolAddr;
+    uint32_t CoreL2ScratchSum = 0U;
+    uint32_t CoreL1ScratchSum = 0U;
 
     int32_t         *dopplerWindow;
     uint32_t        dopplerWindowSize;
@@ -1865,11 +2035,23 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     dopplerWindow = DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj, dopplerWindowSize, DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
     DebugP_assert(dopplerWindow != NULL);
 
-    /* Doppler/AoA DPU Twiddle buffer */
+    /* Doppler/AoA DPU Twiddle buffer. With as many doppler bins as angle bins, the angle FFT twiddle
+     * is the same table as the doppler FFT twiddle (same generator and size), so one copy is
+     * allocated in L1, where the AoA DPU angle FFT expects its twiddle, and shared by both FFTs. */
     dopplerTwiddleSize = staticCfg->numDopplerBins * sizeof(cmplx32ReIm_t);
-    dopplerTwiddle = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
-                                              dopplerTwiddleSize,
-                                              DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+    angleTwiddle32x32Size = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS;
+    if (staticCfg->numDopplerBins == DPU_AOAPROCDSP_NUM_ANGLE_BINS)
+    {
+        dopplerTwiddle = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
+                                                  dopplerTwiddleSize,
+                                                  DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+    }
+    else
+    {
+        dopplerTwiddle = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                  dopplerTwiddleSize,
+                                                  DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+    }
     DebugP_assert(dopplerTwiddle != NULL);
 
     /* Doppler/AoA DPU DFT Sin/Cos table */
@@ -1879,11 +2061,17 @@ static int32_t DPC_ObjDetDSP_preStartConfig
                                               DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
     DebugP_assert(dftSinCosTable != NULL);
 
-    /* AoA DPU Twiddle buffer */
-    angleTwiddle32x32Size = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS;
-    angleTwiddle32x32 = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
-                                          angleTwiddle32x32Size,
-                                          DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+    /* AoA DPU Twiddle buffer, shared with the doppler FFT twiddle if they are the same table */
+    if (staticCfg->numDopplerBins == DPU_AOAPROCDSP_NUM_ANGLE_BINS)
+    {
+        angleTwiddle32x32 = dopplerTwiddle;
+    }
+    else
+    {
+        angleTwiddle32x32 = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
+                                              angleTwiddle32x32Size,
+                                              DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+    }
     DebugP_assert(angleTwiddle32x32 != NULL);
 
     /* Remember pool (L1 & L2) position. These addresses will be the start address for scratch buffers */
@@ -1902,6 +2090,9 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     {
         goto exit;
     }
+
+    CoreL2ScratchSum += DPC_ObjDetDSP_MemPoolGetUsageSince(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
+    CoreL1ScratchSum += DPC_ObjDetDSP_MemPoolGetUsageSince(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
 #endif
 
     /* Rewind to the scratch beginning */
@@ -1924,6 +2115,9 @@ static int32_t DPC_ObjDetDSP_preStartConfig
         goto exit;
     }
 
+    CoreL2ScratchSum += DPC_ObjDetDSP_MemPoolGetUsageSince(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
+    CoreL1ScratchSum += DPC_ObjDetDSP_MemPoolGetUsageSince(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
+
     /* Rewind to the scratch beginning */
     DPC_ObjDetDSP_MemPoolSet(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
     DPC_ObjDetDSP_MemPoolSet(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
@@ -1943,6 +2137,9 @@ static int32_t DPC_ObjDetDSP_preStartConfig
         goto exit;
     }
 
+    CoreL2ScratchSum += DPC_ObjDetDSP_MemPoolGetUsageSince(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
+    CoreL1ScratchSum += DPC_ObjDetDSP_MemPoolGetUsageSince(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
+
     /* Rewind to the scratch beginning */
     DPC_ObjDetDSP_MemPoolSet(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
     DPC_ObjDetDSP_MemPoolSet(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
@@ -1965,11 +2162,22 @@ static int32_t DPC_ObjDetDSP_preStartConfig
         goto exit;
     }
 
+    CoreL2ScratchSum += DPC_ObjDetDSP_MemPoolGetUsageSince(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
+    CoreL1ScratchSum += DPC_ObjDetDSP_MemPoolGetUsageSince(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
+
     /* Report RAM usage */
     *CoreL2RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(CoreL2RamObj);
     *CoreL1RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(CoreL1RamObj);
     *L3RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(L3ramObj);
 
+    /* Each DPU's scratch starts at the same pool position, because the DPUs never run at
+     * the same time. Without this overlay, the pool would need the persistent part plus
+     * the sum of all DPU footprints. */
+    *CoreL2RamScratchSaving = (uint32_t)((uintptr_t)CoreL2ScratchStartPoolAddr - (uintptr_t)CoreL2RamObj->cfg.addr) +
+                              CoreL2ScratchSum - *CoreL2RamUsage;
+    *CoreL1RamScratchSaving = (uint32_t)((uintptr_t)CoreL1ScratchStartPoolAddr - (uintptr_t)CoreL1RamObj->cfg.addr) +
+                              CoreL1ScratchSum - *CoreL1RamUsage;
+
 exit:
     return retVal;
 }
@@ -2121,6 +2329,7 @@ int32_t DPC_ObjectDetection_execute
     DPC_ObjectDetection_ExecuteResult *result;
     int32_t retVal;
     uint8_t numChirpsPerChirpEvent;
+    bool isMeasureOutUpdated;
     int32_t i;
 
     objDetObj = (ObjDetObj *) handle;
@@ -2174,13 +2383,16 @@ int32_t DPC_ObjectDetection_execute
         }
 
         /* Procedure for range bias measurement and Rx channels gain/phase offset measurement */
+        isMeasureOutUpdated = false;
         if(objDetObj->commonCfg.measureRxChannelBiasCfg.enabled)
         {
-            DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure(&subFrmObj->staticCfg,
+            isMeasureOutUpdated = DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure(&subFrmObj->staticCfg,
                 objDetObj->commonCfg.measureRxChannelBiasCfg.targetDistance,
                 objDetObj->commonCfg.measureRxChannelBiasCfg.searchWinSize,
                 subFrmObj->dpuCfg.dopplerCfg.hwRes.detMatrix.data,
                 (uint32_t *) subFrmObj->dpuCfg.dopplerCfg.hwRes.radarCube.data,
+                objDetObj->commonCfg.measureRxChannelBiasCfg.numAvgFrames,
+                &objDetObj->rxChanBiasMeasureAcc,
                 &objDetObj->compRxChanCfgMeasureOut);
         }
 
@@ -2209,7 +2421,7 @@ int32_t DPC_ObjectDetection_execute
         result->azimuthStaticHeatMapSize = subFrmObj->dpuCfg.aoaCfg.res.azimuthStaticHeatMapSize;
         result->radarCube            = subFrmObj->dpuCfg.aoaCfg.res.radarCube;
         result->detMatrix            = subFrmObj->dpuCfg.dopplerCfg.hwRes.detMatrix;
-        if (objDetObj->commonCfg.measureRxChannelBiasCfg.enabled == 1)
+        if (isMeasureOutUpdated == true)
         {
             result->compRxChanBiasMeasurement = &objDetObj->compRxChanCfgMeasureOut;
         }
@@ -2325,6 +2537,7 @@ static int32_t DPC_ObjectDetection_ioctl
 
         objDetObj->commonCfg = *cfg;
         objDetObj->isCommonCfgReceived = true;
+        memset((void *)&objDetObj->rxChanBiasMeasureAcc, 0, sizeof(RxChanBiasMeasureAcc));
 
         DebugP_log0("ObjDet DPC: Pre-start Common Config IOCTL processed\n");
     }
@@ -2546,6 +2759,28 @@ static int32_t DPC_ObjectDetection_ioctl
 
                 break;
             }
+            case DPC_OBJDET_IOCTL__DYNAMIC_CFAR_DET_BUDGET:
+            {
+                DPC_ObjectDetection_CfarDetBudgetCfg *cfg;
+
+                DebugP_assert(argLen == sizeof(DPC_ObjectDetection_CfarDetBudgetCfg));
+
+                cfg = (DPC_ObjectDetection_CfarDetBudgetCfg*)arg;
+
+                retVal = DPU_CFARCAProcDSP_control(subFrmObj->dpuCFARCAObj,
+                             DPU_CFARCAProcDSP_Cmd_DetBudgetCfg,
+                             &cfg->cfg,
+                             sizeof(DPU_CFARCAProc_DetBudgetCfg));
+                if (retVal != 0)
+                {
+                    goto exit;
+                }
+
+                /* save into object */
+                subFrmObj->dynCfg.cfarDetBudget = cfg->cfg;
+
+                break;
+            }
 
             /* AoA DPU related */
             case DPC_OBJDET_IOCTL__DYNAMIC_MULTI_OBJ_BEAM_FORM_CFG:
@@ -2700,6 +2935,11 @@ static int32_t DPC_ObjectDetection_ioctl
 
                 cfg = (DPC_ObjectDetection_PreStartCfg*)arg;
 
+                /* Pre-start configuration regenerates windows and may move the buffers of
+                 * every sub-frame, forget the windows generated in reconfiguration */
+                objDetObj->rangeWindowTag.win = NULL;
+                objDetObj->dopplerWindowTag.win = NULL;
+
                 memUsage = &cfg->memUsage;
                 memUsage->L3RamTotal = objDetObj->L3RamObj.cfg.size;
                 memUsage->CoreL2RamTotal = objDetObj->CoreL2RamObj.cfg.size;
@@ -2713,7 +2953,9 @@ static int32_t DPC_ObjectDetection_ioctl
                              &objDetObj->CoreL1RamObj,
                              &memUsage->L3RamUsage,
                              &memUsage->CoreL2RamUsage,
-                             &memUsage->CoreL1RamUsage);
+                             &memUsage->CoreL1RamUsage,
+                             &memUsage->CoreL2RamScratchSaving,
+                             &memUsage->CoreL1RamScratchSaving);
                 if (retVal != 0)
                 {
                     goto exit;
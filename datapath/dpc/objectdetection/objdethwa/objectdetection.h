@@ -220,6 +220,23 @@ typedef struct DPC_ObjectDetection_extMaxVelCfg_t
    DPU_AoAProc_ExtendedMaxVelocityCfg cfg;
 } DPC_ObjectDetection_extMaxVelCfg;
 
+#if defined(USE_2D_AOA_DPU)
+/*
+ * @brief 2D angle estimation zoom refinement configuration
+ *
+ */
+typedef struct DPC_ObjectDetection_angleZoomCfg_t
+{
+    /*! @brief   Subframe number for which this message is applicable. When
+     *           advanced frame is not used, this should be set to
+     *           0 (the 1st and only sub-frame) */
+   uint8_t subFrameNum;
+
+   /*! @brief    Angle zoom refinement configuration */
+   DPU_AoAProc_AngleZoomCfg cfg;
+} DPC_ObjectDetection_angleZoomCfg;
+#endif
+
 /*
  * @brief Range Bias and rx channel gain/phase compensation configuration.
  *
@@ -441,6 +458,11 @@ typedef struct DPC_ObjectDetection_DynCfg_t
     /*! @brief      Extended maximum velocity configuration */
     DPU_AoAProc_ExtendedMaxVelocityCfg extMaxVelCfg;
 
+#if defined(USE_2D_AOA_DPU)
+    /*! @brief      Angle zoom refinement configuration */
+    DPU_AoAProc_AngleZoomCfg angleZoomCfg;
+#endif
+
     /*! @brief   Static Clutter Removal Cfg */
     DPC_ObjectDetection_StaticClutterRemovalCfg_Base staticClutterRemovalCfg;
 } DPC_ObjectDetection_DynCfg;
@@ -487,6 +509,11 @@ typedef struct DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage_t
      *           amount indicated through @ref DPC_ObjectDetection_InitParams */
     uint32_t CoreLocalRamUsage;
 
+    /*! @brief   Indicates number of bytes of Core Local memory saved by overlaying the scratch
+     *           buffers of the DPUs, i.e. how much larger CoreLocalRamUsage would be if
+     *           every DPU had its own scratch */
+    uint32_t CoreLocalRamScratchSaving;
+
     /*! @brief   Indicates number of bytes of system heap allocated */
     uint32_t SystemHeapTotal;
 
@@ -738,6 +765,14 @@ typedef struct DPC_ObjectDetection_ExecuteResultExportedInfo_t
  *        Must be issued between start and stop of DPC.
  */
 #define DPC_OBJDET_IOCTL__TRIGGER_FRAME                                   (DPM_CMD_DPC_START_INDEX + 15U)
+
+/**
+ * @brief Command associated with @ref DPC_ObjectDetection_angleZoomCfg_t. Supported
+ *        only when the DPC is built with the 2D angle FFT AoA DPU (USE_2D_AOA_DPU).
+ *        The angle zoom table is allocated at pre-start config only if the refinement
+ *        is enabled there, so the command can enable it only up to that zoom factor.
+ */
+#define DPC_OBJDET_IOCTL__DYNAMIC_ANGLE_ZOOM                              (DPM_CMD_DPC_START_INDEX + 16U)
 /**
 @}
 */
@@ -853,6 +888,11 @@ typedef struct DPC_ObjectDetection_ExecuteResultExportedInfo_t
  */
 #define DPC_OBJECTDETECTION_ENOMEM__CORE_LOCAL_RAM_AOA_SCRATCH_BUFFER    (DP_ERRNO_OBJECTDETECTION_BASE-25)
 
+/**
+ * @brief   Error Code: Out of Core Local RAM allocation for AoA's angle zoom table.
+ */
+#define DPC_OBJECTDETECTION_ENOMEM__CORE_LOCAL_RAM_AOA_ANGLE_ZOOM_TABLE    (DP_ERRNO_OBJECTDETECTION_BASE-26)
+
 /**
  * @brief   Error Code: Pre-start config was received before pre-start common config.
  */
@@ -288,6 +288,25 @@ static uint32_t DPC_ObjDet_MemPoolGetMaxUsage(MemPoolObj *pool)
     return((uint32_t)(pool->maxCurrAddr - (uintptr_t)pool->cfg.addr));
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Utility function for getting the amount of memory allocated from the pool
+ *      since the pool was at the given address (see @ref DPC_ObjDet_MemPoolGet).
+ *
+ *  @param[in]  pool Handle to pool object.
+ *  @param[in]  addr Earlier current address of the pool.
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Amount of pool allocated since addr in bytes.
+ */
+static uint32_t DPC_ObjDet_MemPoolGetUsageSince(MemPoolObj *pool, void *addr)
+{
+    return((uint32_t)(pool->currAddr - (uintptr_t)addr));
+}
+
 /**
  *  @b Description
  *  @n
@@ -1965,6 +1984,9 @@ static int32_t DPC_ObjDet_AoAconfig(DPU_AoAProcHWA_Handle dpuHandle,
     aoaCfg.dynCfg.multiObjBeamFormingCfg     = &dynCfg->multiObjBeamFormingCfg;
     aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = dynCfg->prepareRangeAzimuthHeatMap;
     aoaCfg.dynCfg.extMaxVelCfg               = &dynCfg->extMaxVelCfg;
+#if defined(USE_2D_AOA_DPU)
+    aoaCfg.dynCfg.angleZoomCfg               = &dynCfg->angleZoomCfg;
+#endif
 
     /* res */
     res->radarCube = *radarCube;
@@ -2023,6 +2045,21 @@ static int32_t DPC_ObjDet_AoAconfig(DPU_AoAProcHWA_Handle dpuHandle,
        }
     }
 
+#if defined(USE_2D_AOA_DPU)
+    if(dynCfg->angleZoomCfg.enabled)
+    {
+        res->angleZoomTableSize = DPU_AOAPROCHWA_ANGLE_ZOOM_TABLE_SIZE(dynCfg->angleZoomCfg.zoomFactor);
+        res->angleZoomTable = DPC_ObjDet_MemPoolAlloc(CoreLocalRamObj,
+                                  res->angleZoomTableSize * sizeof(float),
+                                  sizeof(float));
+        if (res->angleZoomTable == NULL)
+        {
+            retVal = DPC_OBJECTDETECTION_ENOMEM__CORE_LOCAL_RAM_AOA_ANGLE_ZOOM_TABLE;
+            goto exit;
+        }
+    }
+#endif
+
     if(aoaCfg.dynCfg.prepareRangeAzimuthHeatMap)
     {
 #if defined(USE_2D_AOA_DPU)
@@ -2158,6 +2195,8 @@ exit:
  *              by the DPUs.
  *  @param[out] CoreLocalRamUsage Net Core Local RAM memory usage in bytes as a
  *              result of allocation by the DPUs.
+ *  @param[out] CoreLocalRamScratchSaving Core Local RAM bytes saved by overlaying
+ *              the scratch buffers of the DPUs.
  *
  *  @retval
  *      Success -   0
@@ -2176,7 +2215,8 @@ static int32_t DPC_ObjDet_preStartConfig(SubFrameObj *obj,
                    uint32_t                      hwaMemBankAddr[4],
                    uint16_t                      hwaMemBankSize,
                    uint32_t                      *L3RamUsage,
-                   uint32_t                      *CoreLocalRamUsage)
+                   uint32_t                      *CoreLocalRamUsage,
+                   uint32_t                      *CoreLocalRamScratchSaving)
 {
     int32_t retVal = 0;
     DPIF_RadarCube radarCube;
@@ -2187,6 +2227,7 @@ static int32_t DPC_ObjDet_preStartConfig(SubFrameObj *obj,
     DPIF_CFARDetList *cfarRngDopSnrList;
     uint32_t cfarRngDopSnrListSize;
     void *CoreLocalScratchStartPoolAddr;
+    uint32_t CoreLocalScratchSum = 0U;
 
     /* save configs to object. We need to pass this stored config (instead of
        the input arguments to this function which will be in stack) to
@@ -2256,6 +2297,8 @@ static int32_t DPC_ObjDet_preStartConfig(SubFrameObj *obj,
         goto exit;
     }
 
+    CoreLocalScratchSum += DPC_ObjDet_MemPoolGetUsageSince(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
+
     /* Rewind to the scratch beginning */
     DPC_ObjDet_MemPoolSet(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
 
@@ -2270,6 +2313,8 @@ static int32_t DPC_ObjDet_preStartConfig(SubFrameObj *obj,
         goto exit;
     }
 
+    CoreLocalScratchSum += DPC_ObjDet_MemPoolGetUsageSince(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
+
     /* Rewind to the scratch beginning */
     DPC_ObjDet_MemPoolSet(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
 
@@ -2290,6 +2335,8 @@ static int32_t DPC_ObjDet_preStartConfig(SubFrameObj *obj,
         goto exit;
     }
 
+    CoreLocalScratchSum += DPC_ObjDet_MemPoolGetUsageSince(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
+
     /* Rewind to the scratch beginning */
     DPC_ObjDet_MemPoolSet(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
 
@@ -2339,10 +2386,19 @@ static int32_t DPC_ObjDet_preStartConfig(SubFrameObj *obj,
         goto exit;
     }
 
+    CoreLocalScratchSum += DPC_ObjDet_MemPoolGetUsageSince(CoreLocalRamObj, CoreLocalScratchStartPoolAddr);
+
     /* Report RAM usage */
     *CoreLocalRamUsage = DPC_ObjDet_MemPoolGetMaxUsage(CoreLocalRamObj);
     *L3RamUsage = DPC_ObjDet_MemPoolGetMaxUsage(L3ramObj);
 
+    /* Each DPU's scratch starts at the same pool position, because the DPUs never run at
+     * the same time (doppler and AoA are counted together as AoA uses the doppler window).
+     * Without this overlay, the pool would need the persistent part plus the sum of all
+     * DPU footprints. */
+    *CoreLocalRamScratchSaving = (uint32_t)((uintptr_t)CoreLocalScratchStartPoolAddr - (uintptr_t)CoreLocalRamObj->cfg.addr) +
+                                 CoreLocalScratchSum - *CoreLocalRamUsage;
+
 exit:
     return retVal;
 }
@@ -2693,6 +2749,30 @@ static int32_t DPC_ObjectDetection_ioctl
 
                 break;
             }
+#if defined(USE_2D_AOA_DPU)
+            case DPC_OBJDET_IOCTL__DYNAMIC_ANGLE_ZOOM:
+            {
+                DPC_ObjectDetection_angleZoomCfg *cfg;
+
+                DebugP_assert(argLen == sizeof(DPC_ObjectDetection_angleZoomCfg));
+
+                cfg = (DPC_ObjectDetection_angleZoomCfg*)arg;
+
+                retVal = DPU_AoAProcHWA_control(subFrmObj->dpuAoAObj,
+                             DPU_AoAProcHWA_Cmd_AngleZoomCfg,
+                             &cfg->cfg,
+                             sizeof(DPU_AoAProc_AngleZoomCfg));
+                if (retVal != 0)
+                {
+                    goto exit;
+                }
+
+                /* save into object */
+                subFrmObj->dynCfg.angleZoomCfg = cfg->cfg;
+
+                break;
+            }
+#endif
             case DPC_OBJDET_IOCTL__DYNAMIC_FOV_AOA:
             {
                 DPC_ObjectDetection_fovAoaCfg *cfg;
@@ -2786,7 +2866,8 @@ static int32_t DPC_ObjectDetection_ioctl
                              &objDetObj->hwaMemBankAddr[0],
                              objDetObj->hwaMemBankSize,
                              &memUsage->L3RamUsage,
-                             &memUsage->CoreLocalRamUsage);
+                             &memUsage->CoreLocalRamUsage,
+                             &memUsage->CoreLocalRamScratchSaving);
                 if (retVal != 0)
                 {
                     goto exit;
@@ -1249,10 +1249,11 @@ static void ObjectDetection_Test_reportFxn
                     gMaxTCMUsage = memUsage->CoreLocalRamUsage;
                     gMaxTCMUsageTestId = gCurrTestId;
                 }
-                System_printf("DPC ObjDet Memory usage (SubFrameIndx = %d): L3: %d Bytes, TCM: %d Bytes\n",
+                System_printf("DPC ObjDet Memory usage (SubFrameIndx = %d): L3: %d Bytes, TCM: %d Bytes (%d Bytes saved by scratch overlay)\n",
                               cfg->subFrameNum,
                               memUsage->L3RamUsage,
-                              memUsage->CoreLocalRamUsage);
+                              memUsage->CoreLocalRamUsage,
+                              memUsage->CoreLocalRamScratchSaving);
 
             }
             break;